@@ -17,61 +17,288 @@ Author: Jon Sawler
 */
 #include "Crypto/Base58.h"
 
-#include "CryptoUtils.h"
-#include "Math/BigInt.h"
-#include <string>
-
-constexpr char ALPHABET[58] = {
-	'1', '2', '3', '4', '5', '6', '7', '8',
-	'9', 'A', 'B', 'C', 'D', 'E', 'F', 'G',
-	'H', 'J', 'K', 'L', 'M', 'N', 'P', 'Q',
-	'R', 'S', 'T', 'U', 'V', 'W', 'X', 'Y',
-	'Z', 'a', 'b', 'c', 'd', 'e', 'f', 'g',
-	'h', 'i', 'j', 'k', 'm', 'n', 'o', 'p',
-	'q', 'r', 's', 't', 'u', 'v', 'w', 'x',
-	'y', 'z'
-};
+namespace
+{
+	constexpr ANSICHAR Alphabet[] = "123456789ABCDEFGHJKLMNPQRSTUVWXYZabcdefghijkmnopqrstuvwxyz";
+
+	// Digit value of every ASCII character, -1 outside the alphabet.
+	struct FReverseTable
+	{
+		int8 Digits[256];
+	};
+
+	constexpr FReverseTable MakeReverseTable()
+	{
+		FReverseTable Table{};
+		for (int32 i = 0; i < 256; i++) { Table.Digits[i] = -1; }
+		for (int32 i = 0; i < 58; i++) { Table.Digits[static_cast<uint8>(Alphabet[i])] = static_cast<int8>(i); }
+		return Table;
+	}
+
+	constexpr FReverseTable ReverseTable = MakeReverseTable();
+
+	int32 GetDigit(TCHAR Char)
+	{
+		const uint32 Code = static_cast<uint32>(Char);
+		return Code < 256 ? ReverseTable.Digits[Code] : -1;
+	}
+
+	// The fixed width paths work on limbs of 5 base58 digits.
+	constexpr uint64 Radix58Pow5 = 58ull * 58 * 58 * 58 * 58;
+
+	/**
+	 * Layout of an N byte value: BinarySize big endian 32 bit limbs, IntermediateSize base 58^5 limbs and RawSize
+	 * base58 digits, all most significant first.
+	 */
+	template <int32 N>
+	struct TFixedWidth
+	{
+		static constexpr int32 BinarySize = N / 4;
+		static constexpr int32 IntermediateSize = N == 32 ? 9 : 18;
+		static constexpr int32 RawSize = IntermediateSize * 5;
+		static constexpr int32 MaxEncodedSize = N == 32 ? FBase58::MaxEncoded32Size : FBase58::MaxEncoded64Size;
+	};
+
+	// Row i holds 2^(32 * (BinarySize - 1 - i)) as base 58^5 limbs.
+	template <int32 N>
+	struct TEncodeTable
+	{
+		uint32 Rows[TFixedWidth<N>::BinarySize][TFixedWidth<N>::IntermediateSize];
+	};
+
+	template <int32 N>
+	constexpr TEncodeTable<N> MakeEncodeTable()
+	{
+		using FWidth = TFixedWidth<N>;
+
+		TEncodeTable<N> Table{};
+		Table.Rows[FWidth::BinarySize - 1][FWidth::IntermediateSize - 1] = 1;
+		for (int32 i = FWidth::BinarySize - 2; i >= 0; i--)
+		{
+			uint64 Carry = 0;
+			for (int32 j = FWidth::IntermediateSize - 1; j >= 0; j--)
+			{
+				const uint64 Value = (static_cast<uint64>(Table.Rows[i + 1][j]) << 32) + Carry;
+				Table.Rows[i][j] = static_cast<uint32>(Value % Radix58Pow5);
+				Carry = Value / Radix58Pow5;
+			}
+		}
+		return Table;
+	}
+
+	template <int32 N>
+	constexpr TEncodeTable<N> EncodeTable = MakeEncodeTable<N>();
+
+	template <int32 N>
+	void NormalizeIntermediate(uint64 (&Intermediate)[TFixedWidth<N>::IntermediateSize])
+	{
+		for (int32 j = TFixedWidth<N>::IntermediateSize - 1; j > 0; j--)
+		{
+			Intermediate[j - 1] += Intermediate[j] / Radix58Pow5;
+			Intermediate[j] %= Radix58Pow5;
+		}
+	}
+
+	template <int32 N>
+	int32 EncodeFixed(const uint8* Data, ANSICHAR* Out)
+	{
+		using FWidth = TFixedWidth<N>;
+
+		int32 LeadingZeros = 0;
+		while (LeadingZeros < N && Data[LeadingZeros] == 0) { LeadingZeros++; }
+
+		uint32 Binary[FWidth::BinarySize];
+		for (int32 i = 0; i < FWidth::BinarySize; i++)
+		{
+			const uint8* Word = Data + i * 4;
+			Binary[i] = static_cast<uint32>(Word[0]) << 24 | static_cast<uint32>(Word[1]) << 16 | static_cast<uint32>(Word[2]) << 8 | Word[3];
+		}
+
+		// Each product is below 2^62, so four rows can be accumulated before the carries have to be folded.
+		uint64 Intermediate[FWidth::IntermediateSize] = {};
+		for (int32 i = 0; i < FWidth::BinarySize; i++)
+		{
+			for (int32 j = 0; j < FWidth::IntermediateSize; j++)
+			{
+				Intermediate[j] += static_cast<uint64>(Binary[i]) * EncodeTable<N>.Rows[i][j];
+			}
+			if ((i & 3) == 3) { NormalizeIntermediate<N>(Intermediate); }
+		}
+
+		uint8 Raw[FWidth::RawSize];
+		for (int32 j = 0; j < FWidth::IntermediateSize; j++)
+		{
+			uint32 Limb = static_cast<uint32>(Intermediate[j]);
+			for (int32 k = 4; k >= 0; k--)
+			{
+				Raw[j * 5 + k] = static_cast<uint8>(Limb % 58);
+				Limb /= 58;
+			}
+		}
+
+		int32 Skip = 0;
+		while (Skip < FWidth::RawSize && Raw[Skip] == 0) { Skip++; }
+
+		int32 Len = 0;
+		for (int32 i = 0; i < LeadingZeros; i++) { Out[Len++] = '1'; }
+		for (int32 i = Skip; i < FWidth::RawSize; i++) { Out[Len++] = Alphabet[Raw[i]]; }
+
+		check(Len <= FWidth::MaxEncodedSize);
+		return Len;
+	}
+
+	template <int32 N>
+	bool DecodeFixed(const TCHAR* Encoded, int32 Len, uint8* Out)
+	{
+		using FWidth = TFixedWidth<N>;
+
+		if (Len <= 0 || Len > FWidth::MaxEncodedSize) { return false; }
+
+		// Left pad with zero digits up to a whole number of limbs.
+		uint8       Raw[FWidth::RawSize] = {};
+		const int32 Pad = FWidth::RawSize - Len;
+		for (int32 i = 0; i < Len; i++)
+		{
+			const int32 Digit = GetDigit(Encoded[i]);
+			if (Digit < 0) { return false; }
+			Raw[Pad + i] = static_cast<uint8>(Digit);
+		}
+
+		uint64 Binary[FWidth::BinarySize] = {};
+		for (int32 j = 0; j < FWidth::IntermediateSize; j++)
+		{
+			uint64 Carry = 0;
+			for (int32 k = 0; k < 5; k++) { Carry = Carry * 58 + Raw[j * 5 + k]; }
+
+			for (int32 i = FWidth::BinarySize - 1; i >= 0; i--)
+			{
+				const uint64 Value = Binary[i] * Radix58Pow5 + Carry;
+				Binary[i] = Value & 0xFFFFFFFF;
+				Carry = Value >> 32;
+			}
+
+			// The value does not fit in N bytes.
+			if (Carry != 0) { return false; }
+		}
+
+		uint8 Bytes[N];
+		for (int32 i = 0; i < FWidth::BinarySize; i++)
+		{
+			Bytes[i * 4 + 0] = static_cast<uint8>(Binary[i] >> 24);
+			Bytes[i * 4 + 1] = static_cast<uint8>(Binary[i] >> 16);
+			Bytes[i * 4 + 2] = static_cast<uint8>(Binary[i] >> 8);
+			Bytes[i * 4 + 3] = static_cast<uint8>(Binary[i]);
+		}
+
+		// A canonical encoding has exactly one leading '1' per leading zero byte.
+		int32 LeadingOnes = 0;
+		while (LeadingOnes < Len && Encoded[LeadingOnes] == '1') { LeadingOnes++; }
+		int32 LeadingZeros = 0;
+		while (LeadingZeros < N && Bytes[LeadingZeros] == 0) { LeadingZeros++; }
+		if (LeadingOnes != LeadingZeros) { return false; }
+
+		FMemory::Memcpy(Out, Bytes, N);
+		return true;
+	}
+} // namespace
 
 TArray<uint8> FBase58::DecodeBase58(const FString& encoded)
 {
-	TArray<uint8> result;
+	const TCHAR* Chars = *encoded;
+	const int32  Len = encoded.Len();
 
-	FString alphabet = ALPHABET;
+	int32 Zeros = 0;
+	while (Zeros < Len && Chars[Zeros] == '1') { Zeros++; }
 
-	TBigInt<1024> intData;
-	for (int i = 0; i < encoded.Len(); i++)
+	// log(58) / log(256), rounded up.
+	const int32   Size = (Len - Zeros) * 733 / 1000 + 1;
+	TArray<uint8> Bytes;
+	Bytes.SetNumZeroed(Size);
+
+	int32 Length = 0;
+	for (int32 i = Zeros; i < Len; i++)
 	{
-		int digit = -1;
-		if (!alphabet.FindChar(FTCHARToUTF8(*encoded).Get()[i], digit) || digit < 0)
+		int32 Carry = GetDigit(Chars[i]);
+		if (Carry < 0)
 		{
-			//Error
+			UE_LOG(LogTemp, Error, TEXT("Invalid base58 character in %s"), *encoded);
+			return TArray<uint8>();
 		}
-		intData = intData * 58 + digit;
-	}
 
-	uint32*       bits = intData.GetBits();
-	constexpr int bitEndIndex = (1024 / 32) - 1;
-	for (int k = bitEndIndex; k >= 0; k--) { if (bits[k] != 0) { result.Append(FCryptoUtils::Int32ToDataArrayBE(bits[k])); } }
+		int32 k = 0;
+		for (int32 It = Size - 1; (Carry != 0 || k < Length) && It >= 0; It--, k++)
+		{
+			Carry += 58 * Bytes[It];
+			Bytes[It] = static_cast<uint8>(Carry % 256);
+			Carry /= 256;
+		}
+		Length = k;
+	}
 
-	return result;
+	TArray<uint8> Result;
+	Result.SetNumZeroed(Zeros + Length);
+	FMemory::Memcpy(Result.GetData() + Zeros, Bytes.GetData() + Size - Length, Length);
+	return Result;
 }
 
 FString FBase58::EncodeBase58(const uint8* data, int len)
 {
-	TBigInt<1024> intData = 0;
-	for (int i = 0; i < len; i++) { intData = intData * 256 + data[i]; }
+	ANSICHAR Fixed[MaxEncoded64Size];
+	if (len == 32) { return FString(Encode32(data, Fixed), Fixed); }
+	if (len == 64) { return FString(Encode64(data, Fixed), Fixed); }
 
-	std::string result = "";
-	while (intData.IsGreater(0))
+	int32 Zeros = 0;
+	while (Zeros < len && data[Zeros] == 0) { Zeros++; }
+
+	// log(256) / log(58), rounded up.
+	const int32   Size = (len - Zeros) * 138 / 100 + 1;
+	TArray<uint8> Digits;
+	Digits.SetNumZeroed(Size);
+
+	int32 Length = 0;
+	for (int32 i = Zeros; i < len; i++)
 	{
-		TBigInt<1024> remainder = intData % 58;
-		intData /= 58;
-		result = ALPHABET[remainder.ToInt()] + result;
+		int32 Carry = data[i];
+		int32 k = 0;
+		for (int32 It = Size - 1; (Carry != 0 || k < Length) && It >= 0; It--, k++)
+		{
+			Carry += 256 * Digits[It];
+			Digits[It] = static_cast<uint8>(Carry % 58);
+			Carry /= 58;
+		}
+		Length = k;
 	}
 
-	for (int i = 0; i < len && data[i] == 0; i++) { result = '1' + result; }
+	TArray<ANSICHAR> Result;
+	Result.SetNumUninitialized(Zeros + Length);
+	for (int32 i = 0; i < Zeros; i++) { Result[i] = '1'; }
+	for (int32 i = 0; i < Length; i++) { Result[Zeros + i] = Alphabet[Digits[Size - Length + i]]; }
 
-	return result.c_str();
+	return FString(Result.Num(), Result.GetData());
 }
 
-FString FBase58::EncodeBase58(TArray<uint8> Array) { return EncodeBase58(Array.GetData(), Array.Num()); }
\ No newline at end of file
+FString FBase58::EncodeBase58(const TArray<uint8>& Array) { return EncodeBase58(Array.GetData(), Array.Num()); }
+
+int32 FBase58::Encode32(const uint8* Data, ANSICHAR* Out) { return EncodeFixed<32>(Data, Out); }
+
+int32 FBase58::Encode64(const uint8* Data, ANSICHAR* Out) { return EncodeFixed<64>(Data, Out); }
+
+bool FBase58::Decode32(const TCHAR* Encoded, int32 Len, uint8* Out) { return DecodeFixed<32>(Encoded, Len, Out); }
+
+bool FBase58::Decode64(const TCHAR* Encoded, int32 Len, uint8* Out) { return DecodeFixed<64>(Encoded, Len, Out); }
+
+TArray<FString> FBase58::EncodeBase58Batch(const uint8* Data, int32 Count, int32 Width)
+{
+	TArray<FString> Result;
+	Result.Reserve(Count);
+
+	ANSICHAR Buffer[MaxEncoded64Size];
+	for (int32 i = 0; i < Count; i++)
+	{
+		const uint8* Value = Data + i * Width;
+		if (Width == 32) { Result.Emplace(Encode32(Value, Buffer), Buffer); }
+		else if (Width == 64) { Result.Emplace(Encode64(Value, Buffer), Buffer); }
+		else { Result.Add(EncodeBase58(Value, Width)); }
+	}
+	return Result;
+}
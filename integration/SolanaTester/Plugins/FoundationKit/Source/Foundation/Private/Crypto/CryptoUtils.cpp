@@ -18,11 +18,13 @@ Author: Jon Sawler
 #include "CryptoUtils.h"
 
 #include "Crypto/ed25519/ed25519.h"
+#include "SolanaUtils/Utils/ByteCursor.h"
 
 #define UI UI_ST
 THIRD_PARTY_INCLUDES_START
 #include <openssl/aes.h>
 #include <openssl/evp.h>
+#include <openssl/hmac.h>
 #include "openssl/rand.h"
 #include "openssl/sha.h"
 THIRD_PARTY_INCLUDES_END
@@ -65,39 +67,19 @@ TArray<uint8> FCryptoUtils::HMAC_SHA512(const TArray<uint8>& Data, const FString
 
 TArray<uint8> FCryptoUtils::HMAC_SHA512(const TArray<uint8>& Data, const TArray<uint8>& Key)
 {
-	EVP_PKEY* pkey = nullptr;
-
 	TArray<uint8> Hash;
-	Hash.SetNum(EVP_MAX_MD_SIZE);
-
-	size_t md_len = 0;
-	const EVP_MD* evp = EVP_sha512();
-	EVP_MD_CTX* mdctx = EVP_MD_CTX_create();
-
-	if (mdctx)
-	{
-		pkey = EVP_PKEY_new_mac_key(EVP_PKEY_HMAC, nullptr, Key.GetData(), Key.Num());
-	}
-
-	if (pkey)
-	{
-		if (1 == EVP_DigestSignInit(mdctx, nullptr, evp, nullptr, pkey))
-		{
-			if (1 == EVP_DigestSignUpdate(mdctx, Data.GetData(), Data.Num()))
-			{
-				if (1 == EVP_DigestSignFinal(mdctx, Hash.GetData(), &md_len))
-				{
-					Hash.SetNum(md_len);
-				}
-			}
-		}
-	}
-
-	EVP_PKEY_free(pkey);
-
+	Hash.SetNumUninitialized(64);
+	HMAC_SHA512(Data.GetData(), Data.Num(), Key.GetData(), Key.Num(), Hash.GetData());
 	return Hash;
 }
 
+void FCryptoUtils::HMAC_SHA512(const uint8* Data, int32 DataSize, const uint8* Key, int32 KeySize, uint8* OutHash)
+{
+	unsigned int HashSize = 0;
+	HMAC(EVP_sha512(), Key, KeySize, Data, DataSize, OutHash, &HashSize);
+	check(HashSize == 64);
+}
+
 TArray<uint8> FCryptoUtils::GenerateSeed(const char* Mnemonic, int MnemonicSize, const unsigned char* Salt,
                                          int SaltSize)
 {
@@ -121,9 +103,14 @@ void FCryptoUtils::SignMessage(TArray<uint8>& Signature, const TArray<uint8>& Me
 	ed25519_sign(Signature.GetData(), Message.GetData(), Message.Num(), PrivateKey.GetData());
 }
 
-void FCryptoUtils::VerifyMessage(const TArray<uint8>& Signature, const TArray<uint8>& Message, TArray<uint8>& PublicKey)
+bool FCryptoUtils::VerifyMessage(const TArray<uint8>& Signature, const TArray<uint8>& Message, const TArray<uint8>& PublicKey)
 {
-	ed25519_verify(Signature.GetData(), Message.GetData(), Message.Num(), PublicKey.GetData());
+	if (Signature.Num() != 64 || PublicKey.Num() != 32)
+	{
+		UE_LOG(LogTemp, Error, TEXT("VerifyMessage expects a 64 byte signature and a 32 byte public key"));
+		return false;
+	}
+	return ed25519_verify(Signature.GetData(), Message.GetData(), Message.Num(), PublicKey.GetData()) != 0;
 }
 
 bool FCryptoUtils::RandomBytes(TArray<uint8>& Salt, int32 Length)
@@ -141,58 +128,46 @@ bool FCryptoUtils::RandomBytes(TArray<uint8>& Salt, int32 Length)
 TArray<uint8> FCryptoUtils::Int32ToDataArray(int32 integer)
 {
 	TArray<uint8> result;
-	result.Add(integer & 0xff);
-	result.Add(integer >> 8 & 0xff);
-	result.Add(integer >> 16 & 0xff);
-	result.Add(integer >> 24 & 0xff);
+	result.SetNumUninitialized(4);
+	FByteWriter(result.GetData(), result.Num()).WriteU32LE(integer);
 	return result;
 }
 
 TArray<uint8> FCryptoUtils::Int64ToDataArray(int64 integer)
 {
 	TArray<uint8> result;
-	result.Add(integer & 0xff);
-	result.Add(integer >> 8 & 0xff);
-	result.Add(integer >> 16 & 0xff);
-	result.Add(integer >> 24 & 0xff);
-	result.Add(integer >> 32 & 0xff);
-	result.Add(integer >> 40 & 0xff);
-	result.Add(integer >> 48 & 0xff);
-	result.Add(integer >> 56 & 0xff);
+	result.SetNumUninitialized(8);
+	FByteWriter(result.GetData(), result.Num()).WriteU64LE(integer);
 	return result;
 }
 
 TArray<uint8> FCryptoUtils::Int32ToDataArrayBE(int32 integer)
 {
 	TArray<uint8> result;
-	result.Add(integer >> 24 & 0xff);
-	result.Add(integer >> 16 & 0xff);
-	result.Add(integer >> 8 & 0xff);
-	result.Add(integer & 0xff);
+	result.SetNumUninitialized(4);
+	FByteWriter(result.GetData(), result.Num()).WriteU32BE(integer);
 	return result;
 }
 
 TArray<uint32> FCryptoUtils::SplitBytesByBits(const TArray<uint8>& Data, int BitIncrements)
 {
 	TArray<uint32> Result;
-	const TBitArray<> BitArray = BytesToBitArray(Data);
 	const int ResultNum = Data.Num() * 8 / BitIncrements;
-	for (size_t Index = 0; Index < ResultNum; Index++)
+	Result.Reserve(ResultNum);
+
+	// Bits read but not returned yet are the low NumBits of Buffer.
+	uint64 Buffer = 0;
+	int32 NumBits = 0;
+	int32 ByteIndex = 0;
+	for (int Index = 0; Index < ResultNum; Index++)
 	{
-		uint32 CurrentWord = 0;
-		for (int32 BitIndex = 0; BitIndex < BitIncrements; ++BitIndex)
+		while (NumBits < BitIncrements)
 		{
-			uint32 DataBit = 0;
-			BitArray.GetRange(Index * BitIncrements + BitIndex, 1, &DataBit);
-			const bool Bit = DataBit != 0;
-			if (Bit)
-			{
-				// ReSharper disable all
-				CurrentWord = CurrentWord | (1 << (BitIncrements - 1 - BitIndex));
-				// ReSharper enable all
-			}
+			Buffer = Buffer << 8 | Data[ByteIndex++];
+			NumBits += 8;
 		}
-		Result.Add(CurrentWord);
+		NumBits -= BitIncrements;
+		Result.Add(static_cast<uint32>(Buffer >> NumBits & ((uint64(1) << BitIncrements) - 1)));
 	}
 	return Result;
 }
@@ -228,31 +203,9 @@ TArray<uint8> FCryptoUtils::FStringToUint8(const FString& string)
 
 TArray<uint8> FCryptoUtils::ShortVectorEncodeLength(int32 len)
 {
-	TArray<uint8> output;
-	output.SetNum(10);
-
-	int32 remLen = len;
-	int32 cursor = 0;
-
-	for (;;)
-	{
-		int32 elem = remLen & 0x7f;
-		remLen >>= 7;
-		if (remLen == 0)
-		{
-			output[cursor] = elem;
-			break;
-		}
-		elem |= 0x80;
-		output[cursor] = elem;
-		cursor += 1;
-	}
-
 	TArray<uint8> bytes;
-	for (int i = 0; i < cursor + 1; i++)
-	{
-		bytes.Add(output[i]);
-	}
+	bytes.SetNumUninitialized(FByteWriter::CompactU16Size(len));
+	FByteWriter(bytes.GetData(), bytes.Num()).WriteCompactU16(len);
 	return bytes;
 }
 
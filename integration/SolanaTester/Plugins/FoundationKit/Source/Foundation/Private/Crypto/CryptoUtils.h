@@ -27,12 +27,14 @@ public:
 
 	static TArray<uint8> HMAC_SHA512(const TArray<uint8>& Data, const FString& Key);
 	static TArray<uint8> HMAC_SHA512(const TArray<uint8>& Key, const TArray<uint8>& Data);
+	// Writes the 64 byte HMAC into OutHash without allocating.
+	static void HMAC_SHA512(const uint8* Data, int32 DataSize, const uint8* Key, int32 KeySize, uint8* OutHash);
 
 	static TArray<uint8> GenerateSeed(const char* Mnemonic, int MnemonicSize, const unsigned char*  Salt, int SaltSize);
 	static void GenerateKeyPair(const TArray<uint8>& Seed, TArray<uint8>& OutPublicKey, TArray<uint8>& OutPrivateKey );
 
 	static void SignMessage(TArray<uint8>& Signature, const TArray<uint8>& Message, const TArray<uint8>& PrivateKey);
-	static void VerifyMessage(const TArray<uint8>& Signature, const TArray<uint8>& Message,TArray<uint8>& PublicKey);
+	static bool VerifyMessage(const TArray<uint8>& Signature, const TArray<uint8>& Message, const TArray<uint8>& PublicKey);
 	
 	static bool RandomBytes(TArray<uint8>& Salt, int32 Length);
 
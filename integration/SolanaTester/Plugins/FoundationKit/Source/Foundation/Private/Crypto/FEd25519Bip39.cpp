@@ -19,38 +19,46 @@ Author: Jon Sawler
 #include "FEd25519Bip39.h"
 
 #include "CryptoUtils.h"
+#include "Crypto/HashBatch.h"
+#include "SolanaUtils/Mnemonic.h"
+#include "SolanaUtils/Utils/ByteCursor.h"
 
 const uint32 HardenedOffset = 0x80000000;
-const FString Curve = "ed25519 seed";
+const ANSICHAR Curve[] = "ed25519 seed";
+// 0x00 || key || index, hashed under the parent chain code.
+const int32 ChildDataSize = 1 + 32 + 4;
 
-FEd25519Bip39::FEd25519Bip39(const TArray<uint8>& seed)
+namespace
 {
-    TArray<uint8> hmac = FCryptoUtils::HMAC_SHA512(seed, Curve);
-    for(int i = 0; i < 64; i++)
+    void WriteChildData(const Bip39KeyPair& Parent, uint32 Index, uint8* OutData)
     {
-        if( i < 32 )
-        {
-            KeyPair.MasterKey.Add(hmac[i]);
-        }
-        else
-        {
-            KeyPair.ChainCode.Add(hmac[i]);
-        }
+        FByteWriter Writer(OutData, ChildDataSize);
+        Writer.WriteU8(0);
+        Writer.WriteBytes(Parent.MasterKey, 32);
+        Writer.WriteU32BE(Index);
     }
 }
 
+FEd25519Bip39::FEd25519Bip39(const TArray<uint8>& seed)
+{
+    uint8 Hash[64];
+    FCryptoUtils::HMAC_SHA512(seed.GetData(), seed.Num(), reinterpret_cast<const uint8*>(Curve), sizeof(Curve) - 1, Hash);
+    FMemory::Memcpy(KeyPair.MasterKey, Hash, 32);
+    FMemory::Memcpy(KeyPair.ChainCode, Hash + 32, 32);
+}
+
 TArray<uint8> FEd25519Bip39::DeriveAccountPath(uint32 index)
 {
     //Bip39 Derivation Path = "m/44'/501'/index'/0'"
-    TArray<uint32> segments = { 44, 501, index, 0 };
+    const uint32 segments[] = { 44, 501, index, 0 };
 
     Bip39KeyPair result = KeyPair;
-    for(int i = 0; i < segments.Num(); i++)
+    for(const uint32 segment : segments)
     {
-        result = GetChildKeyDerivation(result.MasterKey, result.ChainCode, segments[i] + HardenedOffset);
+        GetChildKeyDerivation(result, segment + HardenedOffset, result);
     }
 
-    return result.MasterKey;
+    return TArray<uint8>(result.MasterKey, 32);
 }
 
 TArray<uint8> FEd25519Bip39::DeriveAccountPath(const TArray<uint32>& Segments)
@@ -58,33 +66,193 @@ TArray<uint8> FEd25519Bip39::DeriveAccountPath(const TArray<uint32>& Segments)
     Bip39KeyPair Result = KeyPair;
     for(int i = 0; i < Segments.Num(); i++)
     {
-        Result = GetChildKeyDerivation(Result.MasterKey, Result.ChainCode, Segments[i] + HardenedOffset);
+        GetChildKeyDerivation(Result, Segments[i] + HardenedOffset, Result);
+    }
+
+    return TArray<uint8>(Result.MasterKey, 32);
+}
+
+void FEd25519Bip39::DeriveAccountPaths(const TArray<TArray<uint32>>& Paths, TArray<TArray<uint8>>& OutKeys) const
+{
+    TArray<Bip39KeyPair> Results;
+    Results.Init(KeyPair, Paths.Num());
+
+    int32 Depth = 0;
+    for (const TArray<uint32>& Path : Paths) { Depth = FMath::Max(Depth, Path.Num()); }
+
+    TArray<int32> Deriving;
+    TArray<const Bip39KeyPair*> Parents;
+    TArray<uint32> Segments;
+    TArray<Bip39KeyPair> Children;
+    for (int32 Level = 0; Level < Depth; Level++)
+    {
+        Deriving.Reset();
+        Parents.Reset();
+        Segments.Reset();
+        for (int32 i = 0; i < Paths.Num(); i++)
+        {
+            if (Level < Paths[i].Num())
+            {
+                Deriving.Add(i);
+                Parents.Add(&Results[i]);
+                Segments.Add(Paths[i][Level]);
+            }
+        }
+
+        Children.SetNumUninitialized(Deriving.Num());
+        DeriveChildren(Parents, Segments, Children.GetData());
+        for (int32 j = 0; j < Deriving.Num(); j++) { Results[Deriving[j]] = Children[j]; }
+    }
+
+    OutKeys.Reset(Paths.Num());
+    for (const Bip39KeyPair& Result : Results) { OutKeys.Add(TArray<uint8>(Result.MasterKey, 32)); }
+
+    FMemory::Memzero(Results.GetData(), Results.Num() * sizeof(Bip39KeyPair));
+    FMemory::Memzero(Children.GetData(), Children.Num() * sizeof(Bip39KeyPair));
+}
+
+void FEd25519Bip39::DeriveChildren(TConstArrayView<const Bip39KeyPair*> Parents, TConstArrayView<uint32> Segments, Bip39KeyPair* OutChildren)
+{
+    check(Parents.Num() == Segments.Num());
+
+    TArray<uint8> Buffers;
+    TArray<uint8> Hashes;
+    Buffers.SetNumUninitialized(Parents.Num() * ChildDataSize);
+    Hashes.SetNumUninitialized(Parents.Num() * 64);
+
+    TArray<TConstArrayView<uint8>> ChainCodes;
+    TArray<TConstArrayView<uint8>> ChildData;
+    ChainCodes.Reserve(Parents.Num());
+    ChildData.Reserve(Parents.Num());
+    for (int32 i = 0; i < Parents.Num(); i++)
+    {
+        uint8* Buffer = Buffers.GetData() + i * ChildDataSize;
+        WriteChildData(*Parents[i], Segments[i] + HardenedOffset, Buffer);
+        ChainCodes.Add(TConstArrayView<uint8>(Parents[i]->ChainCode, 32));
+        ChildData.Add(TConstArrayView<uint8>(Buffer, ChildDataSize));
+    }
+
+    // Children are written once every hash is done, so they may overwrite their parents.
+    FHashBatch::HMAC_SHA512(ChainCodes, ChildData, Hashes.GetData());
+    for (int32 i = 0; i < Parents.Num(); i++)
+    {
+        FMemory::Memcpy(OutChildren[i].MasterKey, Hashes.GetData() + i * 64, 32);
+        FMemory::Memcpy(OutChildren[i].ChainCode, Hashes.GetData() + i * 64 + 32, 32);
     }
 
-    return Result.MasterKey;
+    FMemory::Memzero(Buffers.GetData(), Buffers.Num());
+    FMemory::Memzero(Hashes.GetData(), Hashes.Num());
+}
+
+void FEd25519Bip39::GetChildKeyDerivation(const Bip39KeyPair& Parent, uint32 Index, Bip39KeyPair& OutChild)
+{
+    uint8 Buffer[ChildDataSize];
+    WriteChildData(Parent, Index, Buffer);
+
+    // The HMAC output is the child key followed by the child chain code, Parent may alias OutChild.
+    uint8 Hash[64];
+    FCryptoUtils::HMAC_SHA512(Buffer, sizeof(Buffer), Parent.ChainCode, 32, Hash);
+    FMemory::Memcpy(OutChild.MasterKey, Hash, 32);
+    FMemory::Memcpy(OutChild.ChainCode, Hash + 32, 32);
+}
+
+FBip39DerivationCache::FPathPrefix::FPathPrefix(const TArray<uint32>& Path, int32 Length)
+    : Segments(Path.GetData(), Length)
+    , Hash(FCrc::MemCrc32(Path.GetData(), Length * sizeof(uint32)))
+{
+}
+
+FBip39DerivationCache::~FBip39DerivationCache()
+{
+    Reset();
 }
 
-Bip39KeyPair FEd25519Bip39::GetChildKeyDerivation(const TArray<uint8>& key, const TArray<uint8>& chainCode, uint32 index)
+void FBip39DerivationCache::DeriveAccountPaths(const FMnemonic& Mnemonic, const TArray<TArray<uint32>>& Paths, TArray<TArray<uint8>>& OutKeys)
 {
-    TArray<uint8> buffer;
-    buffer.Add(0);
-    buffer.Append(key);
-    buffer.Append(FCryptoUtils::Int32ToDataArrayBE(index));
+    FScopeLock ScopeLock(&Lock);
+
+    if (!bHasMaster)
+    {
+        TArray<uint8> Seed = Mnemonic.DeriveSeed();
+        FEd25519Bip39 Root(Seed);
+        Master = Root.KeyPair;
+        FMemory::Memzero(&Root.KeyPair, sizeof(Bip39KeyPair));
+        FMemory::Memzero(Seed.GetData(), Seed.Num());
+        bHasMaster = true;
+    }
 
-    TArray<uint8> hmac = FCryptoUtils::HMAC_SHA512( buffer, chainCode );
+    int32 Depth = 0;
+    for (const TArray<uint32>& Path : Paths) { Depth = FMath::Max(Depth, Path.Num()); }
 
-    Bip39KeyPair keypair;
-    for(int i = 0; i < 64; i++)
+    // Nodes above the leaves, shortest prefixes first so the parent of every missing node is already cached.
+    TSet<FPathPrefix> Missing;
+    TArray<const Bip39KeyPair*> Parents;
+    TArray<uint32> Segments;
+    TArray<Bip39KeyPair> Children;
+    for (int32 Length = 1; Length < Depth; Length++)
     {
-        if( i < 32 )
+        Missing.Reset();
+        for (const TArray<uint32>& Path : Paths)
         {
-            keypair.MasterKey.Add(hmac[i]);
+            if (Path.Num() > Length)
+            {
+                FPathPrefix Prefix(Path, Length);
+                if (!Nodes.Contains(Prefix)) { Missing.Add(MoveTemp(Prefix)); }
+            }
         }
-        else
+        if (Missing.IsEmpty()) { continue; }
+
+        Parents.Reset();
+        Segments.Reset();
+        for (const FPathPrefix& Prefix : Missing)
         {
-            keypair.ChainCode.Add(hmac[i]);
+            Parents.Add(&GetNode(Prefix.Segments, Length - 1));
+            Segments.Add(Prefix.Segments.Last());
+        }
+
+        Children.SetNumUninitialized(Missing.Num());
+        FEd25519Bip39::DeriveChildren(Parents, Segments, Children.GetData());
+
+        // Adding may move the cached nodes, the parents are not used past this point.
+        int32 Index = 0;
+        for (const FPathPrefix& Prefix : Missing) { Nodes.Add(Prefix, Children[Index++]); }
+    }
+
+    // The leaves are account keys and are not kept.
+    TArray<int32> Leaves;
+    Parents.Reset();
+    Segments.Reset();
+    for (int32 i = 0; i < Paths.Num(); i++)
+    {
+        if (!Paths[i].IsEmpty())
+        {
+            Leaves.Add(i);
+            Parents.Add(&GetNode(Paths[i], Paths[i].Num() - 1));
+            Segments.Add(Paths[i].Last());
         }
     }
 
-    return keypair;
+    Children.SetNumUninitialized(Leaves.Num());
+    FEd25519Bip39::DeriveChildren(Parents, Segments, Children.GetData());
+
+    OutKeys.Reset(Paths.Num());
+    for (int32 i = 0; i < Paths.Num(); i++) { OutKeys.Add(TArray<uint8>(Master.MasterKey, 32)); }
+    for (int32 j = 0; j < Leaves.Num(); j++) { FMemory::Memcpy(OutKeys[Leaves[j]].GetData(), Children[j].MasterKey, 32); }
+
+    FMemory::Memzero(Children.GetData(), Children.Num() * sizeof(Bip39KeyPair));
+}
+
+void FBip39DerivationCache::Reset()
+{
+    FScopeLock ScopeLock(&Lock);
+
+    for (auto& [Prefix, Node] : Nodes) { FMemory::Memzero(&Node, sizeof(Bip39KeyPair)); }
+    Nodes.Empty();
+    FMemory::Memzero(&Master, sizeof(Bip39KeyPair));
+    bHasMaster = false;
+}
+
+const Bip39KeyPair& FBip39DerivationCache::GetNode(const TArray<uint32>& Path, int32 Length) const
+{
+    return Length == 0 ? Master : Nodes.FindChecked(FPathPrefix(Path, Length));
 }
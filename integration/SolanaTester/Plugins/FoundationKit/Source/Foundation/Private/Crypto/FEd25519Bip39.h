@@ -18,10 +18,12 @@ Contributers: Daniele Calanna
 */
 #pragma once
 
+class FMnemonic;
+
 struct Bip39KeyPair
 {
-	TArray<uint8> MasterKey;
-	TArray<uint8> ChainCode;
+	uint8 MasterKey[32];
+	uint8 ChainCode[32];
 };
 
 class FEd25519Bip39
@@ -32,10 +34,51 @@ public:
 
 	TArray<uint8> DeriveAccountPath(uint32 index);
 	TArray<uint8> DeriveAccountPath(const TArray<uint32>& Segments);
+	// Derives the key of every path, the HMACs of each level run as one batch.
+	void DeriveAccountPaths(const TArray<TArray<uint32>>& Paths, TArray<TArray<uint8>>& OutKeys) const;
+
+	// Derives the hardened child Segments[i] of every Parents[i] as one batch of HMACs.
+	static void DeriveChildren(TConstArrayView<const Bip39KeyPair*> Parents, TConstArrayView<uint32> Segments, Bip39KeyPair* OutChildren);
 
 	Bip39KeyPair KeyPair;
 
 private:
 
-	Bip39KeyPair GetChildKeyDerivation(const TArray<uint8>& key, const TArray<uint8>& chainCode, uint32 index);
+	static void GetChildKeyDerivation(const Bip39KeyPair& Parent, uint32 Index, Bip39KeyPair& OutChild);
+};
+
+/**
+ * Keeps the master node of a mnemonic and every node derived above a leaf, so the seed is computed once and paths
+ * sharing a hardened prefix such as m/44'/501' only hash the segments past it. Holds private keys, Reset() wipes them
+ * and must be called whenever the mnemonic changes.
+ */
+class FBip39DerivationCache
+{
+public:
+	~FBip39DerivationCache();
+
+	// Same results as FEd25519Bip39(Mnemonic.DeriveSeed()).DeriveAccountPaths(Paths, OutKeys).
+	void DeriveAccountPaths(const FMnemonic& Mnemonic, const TArray<TArray<uint32>>& Paths, TArray<TArray<uint8>>& OutKeys);
+
+	void Reset();
+
+private:
+	struct FPathPrefix
+	{
+		TArray<uint32> Segments;
+		uint32         Hash = 0;
+
+		FPathPrefix(const TArray<uint32>& Path, int32 Length);
+
+		bool operator==(const FPathPrefix& Other) const { return Hash == Other.Hash && Segments == Other.Segments; }
+
+		friend uint32 GetTypeHash(const FPathPrefix& Prefix) { return Prefix.Hash; }
+	};
+
+	const Bip39KeyPair& GetNode(const TArray<uint32>& Path, int32 Length) const;
+
+	FCriticalSection                Lock;
+	bool                            bHasMaster = false;
+	Bip39KeyPair                    Master;
+	TMap<FPathPrefix, Bip39KeyPair> Nodes;
 };
@@ -0,0 +1,273 @@
+/*
+Copyright 2022 ATMTA, Inc.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+	http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+#include "Crypto/HashBatch.h"
+
+#include "Crypto/Sha/ShaKernels.h"
+
+// Inputs above this many blocks are not copied into lanes, they are hashed in place on their own.
+constexpr int32 MaxLaneBlocks = 16;
+
+constexpr int32 HmacBlockSize = 128;
+
+namespace
+{
+	struct FSha256Traits
+	{
+		using FWord = uint32;
+		using FCompress = FShaKernels::FCompress256;
+		using FCompressN = FShaKernels::FCompress256xN;
+		static constexpr int32 BlockSize = 64;
+		static constexpr int32 DigestSize = FHashBatch::SHA256Size;
+		static constexpr const FWord (&InitialState)[8] = ConstexprSha256::InitialState;
+	};
+
+	struct FSha512Traits
+	{
+		using FWord = uint64;
+		using FCompress = FShaKernels::FCompress512;
+		using FCompressN = FShaKernels::FCompress512xN;
+		static constexpr int32 BlockSize = 128;
+		static constexpr int32 DigestSize = FHashBatch::SHA512Size;
+		static constexpr FWord InitialState[8] = {
+			0x6a09e667f3bcc908ULL, 0xbb67ae8584caa73bULL, 0x3c6ef372fe94f82bULL, 0xa54ff53a5f1d36f1ULL,
+			0x510e527fade682d1ULL, 0x9b05688c2b3e6c1fULL, 0x1f83d9abfb41bd6bULL, 0x5be0cd19137e2179ULL,
+		};
+	};
+
+	// Blocks of a padded message: the data, a 0x80 byte and the bit length in the last 8 bytes of the block.
+	template <typename Traits>
+	int32 GetBlockCount(int32 Size)
+	{
+		// SHA-512 reserves 16 bytes for the length, the upper 8 are always zero here.
+		constexpr int32 LengthSize = Traits::BlockSize / 8;
+		return (Size + 1 + LengthSize + Traits::BlockSize - 1) / Traits::BlockSize;
+	}
+
+	// MessageSize is the length of the whole message, of which Data may be the tail.
+	template <typename Traits>
+	void Pad(const uint8* Data, int32 Size, int32 MessageSize, int32 NumBlocks, uint8* OutBlocks)
+	{
+		const int32 PaddedSize = NumBlocks * Traits::BlockSize;
+		if (Size > 0) { FMemory::Memcpy(OutBlocks, Data, Size); }
+		OutBlocks[Size] = 0x80;
+		FMemory::Memzero(OutBlocks + Size + 1, PaddedSize - Size - 1 - 8);
+
+		const uint64 Bits = static_cast<uint64>(MessageSize) * 8;
+		for (int32 i = 0; i < 8; i++) { OutBlocks[PaddedSize - 1 - i] = static_cast<uint8>(Bits >> (i * 8)); }
+	}
+
+	template <typename Traits>
+	void WriteDigest(const typename Traits::FWord* State, uint8* OutDigest)
+	{
+		using FWord = typename Traits::FWord;
+		for (int32 Word = 0; Word < 8; Word++)
+		{
+			for (int32 i = 0; i < static_cast<int32>(sizeof(FWord)); i++)
+			{
+				OutDigest[Word * sizeof(FWord) + i] = static_cast<uint8>(State[Word] >> ((sizeof(FWord) - 1 - i) * 8));
+			}
+		}
+	}
+
+	// Whole blocks are compressed from Data directly, only the last one or two are padded in a copy.
+	template <typename Traits>
+	void HashOne(const uint8* Data, int32 Size, uint8* OutDigest, typename Traits::FCompress Compress)
+	{
+		typename Traits::FWord State[8];
+		FMemory::Memcpy(State, Traits::InitialState, sizeof(State));
+
+		const int32 FullBlocks = Size / Traits::BlockSize;
+		if (FullBlocks > 0) { Compress(State, Data, FullBlocks); }
+
+		uint8       Tail[2 * Traits::BlockSize];
+		const int32 TailSize = Size - FullBlocks * Traits::BlockSize;
+		const int32 TailBlocks = GetBlockCount<Traits>(TailSize);
+		Pad<Traits>(Data + FullBlocks * Traits::BlockSize, TailSize, Size, TailBlocks, Tail);
+		Compress(State, Tail, TailBlocks);
+
+		// The tail may hold key material, HMAC keys go through here.
+		FPlatformMemory::Memzero(Tail, sizeof(Tail));
+		WriteDigest<Traits>(State, OutDigest);
+	}
+
+	/**
+	 * Sorts the inputs by block count and hashes every run of equal counts Lanes at a time. Runs too short to fill
+	 * half the lanes, and inputs too long to copy, go through the single stream kernel.
+	 */
+	template <typename Traits>
+	void HashMany(TConstArrayView<TConstArrayView<uint8>> Inputs, uint8* OutDigests, typename Traits::FCompress Compress,
+		typename Traits::FCompressN CompressN, int32 Lanes)
+	{
+		using FWord = typename Traits::FWord;
+
+		if (!CompressN || Inputs.Num() < 2)
+		{
+			for (int32 i = 0; i < Inputs.Num(); i++)
+			{
+				HashOne<Traits>(Inputs[i].GetData(), Inputs[i].Num(), OutDigests + i * Traits::DigestSize, Compress);
+			}
+			return;
+		}
+
+		TArray<int32> BlockCounts;
+		TArray<int32> Order;
+		BlockCounts.SetNumUninitialized(Inputs.Num());
+		Order.SetNumUninitialized(Inputs.Num());
+		for (int32 i = 0; i < Inputs.Num(); i++)
+		{
+			BlockCounts[i] = GetBlockCount<Traits>(Inputs[i].Num());
+			Order[i] = i;
+		}
+		Order.Sort([&BlockCounts](int32 A, int32 B) { return BlockCounts[A] < BlockCounts[B]; });
+
+		TArray<uint8>        Scratch;
+		TArray<FWord>        States;
+		TArray<const uint8*> LaneData;
+		States.SetNumUninitialized(Lanes * 8);
+		LaneData.SetNumUninitialized(Lanes);
+
+		for (int32 Start = 0; Start < Order.Num();)
+		{
+			const int32 NumBlocks = BlockCounts[Order[Start]];
+			int32       End = Start + 1;
+			while (End < Order.Num() && End - Start < Lanes && BlockCounts[Order[End]] == NumBlocks) { End++; }
+
+			const int32 Count = End - Start;
+			if (Count * 2 < Lanes || Count == 1 || NumBlocks > MaxLaneBlocks)
+			{
+				for (int32 i = Start; i < End; i++)
+				{
+					const int32 Index = Order[i];
+					HashOne<Traits>(Inputs[Index].GetData(), Inputs[Index].Num(), OutDigests + Index * Traits::DigestSize, Compress);
+				}
+				Start = End;
+				continue;
+			}
+
+			const int32 MessageSize = NumBlocks * Traits::BlockSize;
+			Scratch.SetNumUninitialized(Count * MessageSize);
+			for (int32 Lane = 0; Lane < Lanes; Lane++)
+			{
+				// Spare lanes hash the first message again, their result is dropped.
+				if (Lane < Count)
+				{
+					const TConstArrayView<uint8>& Input = Inputs[Order[Start + Lane]];
+					Pad<Traits>(Input.GetData(), Input.Num(), Input.Num(), NumBlocks, Scratch.GetData() + Lane * MessageSize);
+				}
+				LaneData[Lane] = Scratch.GetData() + (Lane < Count ? Lane : 0) * MessageSize;
+				FMemory::Memcpy(States.GetData() + Lane * 8, Traits::InitialState, sizeof(Traits::InitialState));
+			}
+
+			CompressN(States.GetData(), LaneData.GetData(), NumBlocks);
+
+			for (int32 Lane = 0; Lane < Count; Lane++)
+			{
+				WriteDigest<Traits>(States.GetData() + Lane * 8, OutDigests + Order[Start + Lane] * Traits::DigestSize);
+			}
+			Start = End;
+		}
+
+		// The inputs may be key material.
+		FMemory::Memzero(Scratch.GetData(), Scratch.Num());
+	}
+} // namespace
+
+void FHashBatch::SHA256(TConstArrayView<TConstArrayView<uint8>> Inputs, uint8* OutDigests)
+{
+	const FShaKernels& Kernels = FShaKernels::Get();
+	HashMany<FSha256Traits>(Inputs, OutDigests, Kernels.Compress256, Kernels.Compress256xN, Kernels.Lanes256);
+}
+
+void FHashBatch::SHA512(TConstArrayView<TConstArrayView<uint8>> Inputs, uint8* OutDigests)
+{
+	const FShaKernels& Kernels = FShaKernels::Get();
+	HashMany<FSha512Traits>(Inputs, OutDigests, Kernels.Compress512, Kernels.Compress512xN, Kernels.Lanes512);
+}
+
+void FHashBatch::HMAC_SHA512(TConstArrayView<TConstArrayView<uint8>> Keys, TConstArrayView<TConstArrayView<uint8>> Data, uint8* OutMacs)
+{
+	check(Keys.Num() == Data.Num());
+	const int32 Num = Keys.Num();
+
+	// Inner messages are (Key ^ ipad) || Data, outer ones (Key ^ opad) || inner digest, both hashed as one batch.
+	constexpr int32 OuterSize = HmacBlockSize + SHA512Size;
+
+	int32 InnerSize = 0;
+	for (const TConstArrayView<uint8>& Message : Data) { InnerSize += HmacBlockSize + Message.Num(); }
+
+	TArray<uint8> Inner;
+	TArray<uint8> Outer;
+	TArray<uint8> InnerDigests;
+	Inner.SetNumUninitialized(InnerSize);
+	Outer.SetNumUninitialized(Num * OuterSize);
+	InnerDigests.SetNumUninitialized(Num * SHA512Size);
+
+	TArray<TConstArrayView<uint8>> InnerViews;
+	TArray<TConstArrayView<uint8>> OuterViews;
+	InnerViews.Reserve(Num);
+	OuterViews.Reserve(Num);
+
+	int32 Offset = 0;
+	for (int32 i = 0; i < Num; i++)
+	{
+		// Keys longer than a block are replaced by their hash.
+		uint8 Key[HmacBlockSize] = {};
+		if (Keys[i].Num() > HmacBlockSize) { SHA512(Keys[i].GetData(), Keys[i].Num(), Key); }
+		else if (Keys[i].Num() > 0) { FMemory::Memcpy(Key, Keys[i].GetData(), Keys[i].Num()); }
+
+		uint8* InnerMessage = Inner.GetData() + Offset;
+		uint8* OuterMessage = Outer.GetData() + i * OuterSize;
+		for (int32 j = 0; j < HmacBlockSize; j++)
+		{
+			InnerMessage[j] = Key[j] ^ 0x36;
+			OuterMessage[j] = Key[j] ^ 0x5c;
+		}
+		if (Data[i].Num() > 0) { FMemory::Memcpy(InnerMessage + HmacBlockSize, Data[i].GetData(), Data[i].Num()); }
+		FMemory::Memzero(Key, sizeof(Key));
+
+		InnerViews.Add(TConstArrayView<uint8>(InnerMessage, HmacBlockSize + Data[i].Num()));
+		OuterViews.Add(TConstArrayView<uint8>(OuterMessage, OuterSize));
+		Offset += HmacBlockSize + Data[i].Num();
+	}
+
+	SHA512(InnerViews, InnerDigests.GetData());
+	for (int32 i = 0; i < Num; i++) { FMemory::Memcpy(Outer.GetData() + i * OuterSize + HmacBlockSize, InnerDigests.GetData() + i * SHA512Size, SHA512Size); }
+	SHA512(OuterViews, OutMacs);
+
+	FMemory::Memzero(Inner.GetData(), Inner.Num());
+	FMemory::Memzero(Outer.GetData(), Outer.Num());
+	FMemory::Memzero(InnerDigests.GetData(), InnerDigests.Num());
+}
+
+void FHashBatch::SHA256(const uint8* Data, int32 Size, uint8* OutDigest)
+{
+	HashOne<FSha256Traits>(Data, Size, OutDigest, FShaKernels::Get().Compress256);
+}
+
+void FHashBatch::SHA512(const uint8* Data, int32 Size, uint8* OutDigest)
+{
+	HashOne<FSha512Traits>(Data, Size, OutDigest, FShaKernels::Get().Compress512);
+}
+
+const TCHAR* FHashBatch::GetSHA256Kernel()
+{
+	return FShaKernels::Get().Name256;
+}
+
+const TCHAR* FHashBatch::GetSHA512Kernel()
+{
+	return FShaKernels::Get().Name512;
+}
@@ -0,0 +1,89 @@
+/*
+Copyright 2022 ATMTA, Inc.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+	http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+#include "Crypto/KeypairBatch.h"
+
+#include "Async/ParallelFor.h"
+#include "Crypto/CryptoUtils.h"
+#include "Crypto/ed25519/ed25519.h"
+#include "SolanaUtils/Account.h"
+
+FKeypairBatch::~FKeypairBatch()
+{
+	Reset();
+}
+
+bool FKeypairBatch::Generate(int32 Count)
+{
+	if (Count <= 0) { return true; }
+
+	TArray<uint8> Seeds;
+	if (!FCryptoUtils::RandomBytes(Seeds, Count * SeedSize))
+	{
+		UE_LOG(LogTemp, Error, TEXT("Unable to generate random seeds for %d keypairs"), Count);
+		FMemory::Memzero(Seeds.GetData(), Seeds.Num());
+		return false;
+	}
+
+	AddFromSeeds(Seeds);
+	FMemory::Memzero(Seeds.GetData(), Seeds.Num());
+	return true;
+}
+
+void FKeypairBatch::AddFromSeeds(TConstArrayView<uint8> Seeds)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FKeypairBatch::AddFromSeeds)
+
+	if (Seeds.Num() % SeedSize != 0)
+	{
+		UE_LOG(LogTemp, Error, TEXT("Keypair seeds must be %d bytes each, got %d bytes"), SeedSize, Seeds.Num());
+		return;
+	}
+
+	const int32 Start = Num();
+	const int32 Count = Seeds.Num() / SeedSize;
+
+	// Grown by hand so the keys are not left behind in a freed allocation.
+	const int32 Size = (Start + Count) * KeypairSize;
+	if (Keypairs.Max() < Size)
+	{
+		TArray<uint8> Grown;
+		Grown.Reserve(FMath::Max(Size, Keypairs.Max() * 2));
+		Grown.Append(Keypairs);
+		Reset();
+		Keypairs = MoveTemp(Grown);
+	}
+	Keypairs.AddUninitialized(Count * KeypairSize);
+
+	ParallelFor(Count, [&](int32 Index)
+	{
+		uint8 PublicKey[FPublicKey::Size];
+		ed25519_create_keypair(PublicKey, Keypairs.GetData() + (Start + Index) * KeypairSize, Seeds.GetData() + Index * SeedSize);
+	});
+}
+
+FAccount FKeypairBatch::ToAccount(int32 Index) const
+{
+	TArray<uint8> Keypair(GetKeypair(Index), KeypairSize);
+	FAccount      Account = FAccount::FromPrivateKey(Keypair);
+	FMemory::Memzero(Keypair.GetData(), Keypair.Num());
+	return Account;
+}
+
+void FKeypairBatch::Reset()
+{
+	FMemory::Memzero(Keypairs.GetData(), Keypairs.Num());
+	Keypairs.Empty();
+}
@@ -0,0 +1,283 @@
+﻿#include "Crypto/ProgramDerivedAccount.h"
+
+#include "Async/ParallelFor.h"
+#include "Containers/LruCache.h"
+#include "Crypto/HashBatch.h"
+#include "ed25519/ed25519.h"
+
+#define UI UI_ST
+THIRD_PARTY_INCLUDES_START
+#include "openssl/sha.h"
+THIRD_PARTY_INCLUDES_END
+#undef UI
+
+static constexpr ANSICHAR ProgramDerivedAddressMarker[] = "ProgramDerivedAddress";
+
+namespace
+{
+	// Program id and length prefixed seeds, so ["ab", "c"] and ["a", "bc"] are different keys.
+	struct FAddressCacheKey
+	{
+		TArray<uint8> Bytes;
+		uint32        Hash = 0;
+
+		FAddressCacheKey() = default;
+
+		FAddressCacheKey(const TArray<TArray<uint8>>& Seeds, const FPublicKey& ProgramId)
+		{
+			int32 Size = FPublicKey::Size;
+			for (const TArray<uint8>& Seed : Seeds) { Size += 1 + Seed.Num(); }
+
+			Bytes.Reserve(Size);
+			Bytes.Append(ProgramId.GetData(), FPublicKey::Size);
+			for (const TArray<uint8>& Seed : Seeds)
+			{
+				Bytes.Add(static_cast<uint8>(Seed.Num()));
+				Bytes.Append(Seed);
+			}
+			Hash = FCrc::MemCrc32(Bytes.GetData(), Bytes.Num());
+		}
+
+		bool operator==(const FAddressCacheKey& Other) const { return Hash == Other.Hash && Bytes == Other.Bytes; }
+
+		friend uint32 GetTypeHash(const FAddressCacheKey& Key) { return Key.Hash; }
+	};
+
+	struct FAddressCache
+	{
+		FCriticalSection                             Lock;
+		TLruCache<FAddressCacheKey, FProgramAddress> Entries{ FProgramDerivedAccount::DefaultCacheCapacity };
+	};
+
+	FAddressCache& GetAddressCache()
+	{
+		static FAddressCache Cache;
+		return Cache;
+	}
+
+	bool AreSeedsValid(const TArray<TArray<uint8>>& Seeds, int32 MaxSeeds)
+	{
+		if (Seeds.Num() > MaxSeeds)
+		{
+			UE_LOG(LogTemp, Error, TEXT("Max seeds exceeded"));
+			return false;
+		}
+
+		for (const TArray<uint8>& Seed : Seeds)
+		{
+			if (Seed.Num() > FProgramDerivedAccount::MaxSeedLength)
+			{
+				UE_LOG(LogTemp, Error, TEXT("Max seed length exceeded"));
+				return false;
+			}
+		}
+		return true;
+	}
+
+	void HashSeeds(const TArray<TArray<uint8>>& Seeds, SHA256_CTX& OutContext)
+	{
+		SHA256_Init(&OutContext);
+		for (const TArray<uint8>& Seed : Seeds) { SHA256_Update(&OutContext, Seed.GetData(), Seed.Num()); }
+	}
+
+	// Finishes a copy of the seed midstate with the optional bump, the program id and the marker.
+	// Returns false if the hash is a valid curve point.
+	bool FinishAddress(SHA256_CTX Context, const uint8* Bump, const FPublicKey& ProgramId, FPublicKey& OutAddress)
+	{
+		uint8 Hash[FPublicKey::Size];
+		if (Bump) { SHA256_Update(&Context, Bump, 1); }
+		SHA256_Update(&Context, ProgramId.GetData(), FPublicKey::Size);
+		SHA256_Update(&Context, ProgramDerivedAddressMarker, sizeof(ProgramDerivedAddressMarker) - 1);
+		SHA256_Final(Hash, &Context);
+
+		if (is_point_on_curve(Hash)) { return false; }
+
+		OutAddress = FPublicKey(Hash);
+		return true;
+	}
+
+	// Searches bumps downwards from FirstBump, callers that already tried 255 start below it.
+	FProgramAddress DeriveProgramAddress(const TArray<TArray<uint8>>& Seeds, const FPublicKey& ProgramId, int32 FirstBump = 255)
+	{
+		FProgramAddress Result;
+
+		SHA256_CTX Seeded;
+		HashSeeds(Seeds, Seeded);
+
+		for (int32 Bump = FirstBump; Bump >= 0; --Bump)
+		{
+			const uint8 BumpSeed = static_cast<uint8>(Bump);
+			if (FinishAddress(Seeded, &BumpSeed, ProgramId, Result.Address))
+			{
+				Result.Bump = Bump;
+				return Result;
+			}
+		}
+
+		UE_LOG(LogTemp, Error, TEXT("Unable to find a viable program address nonce"));
+		return Result;
+	}
+} // namespace
+
+bool FProgramDerivedAccount::CreateProgramAddress(const TArray<TArray<uint8>>& Seeds, const FPublicKey& ProgramId, FPublicKey& OutAddress)
+{
+	if (!AreSeedsValid(Seeds, MaxSeeds)) { return false; }
+
+	SHA256_CTX Seeded;
+	HashSeeds(Seeds, Seeded);
+	return FinishAddress(Seeded, nullptr, ProgramId, OutAddress);
+}
+
+FProgramAddress FProgramDerivedAccount::FindProgramAddress(const TArray<TArray<uint8>>& Seeds, const FPublicKey& ProgramId)
+{
+	// One slot is left for the bump.
+	if (!AreSeedsValid(Seeds, MaxSeeds - 1)) { return FProgramAddress(); }
+
+	const FAddressCacheKey Key(Seeds, ProgramId);
+	FAddressCache&         Cache = GetAddressCache();
+	{
+		FScopeLock ScopeLock(&Cache.Lock);
+		if (const FProgramAddress* Cached = Cache.Entries.FindAndTouch(Key)) { return *Cached; }
+	}
+
+	const FProgramAddress Result = DeriveProgramAddress(Seeds, ProgramId);
+	if (Result.IsValid())
+	{
+		FScopeLock ScopeLock(&Cache.Lock);
+		Cache.Entries.Add(Key, Result);
+	}
+	return Result;
+}
+
+void FProgramDerivedAccount::FindProgramAddresses(const TArray<FProgramAddressQuery>& Queries, TArray<FProgramAddress>& OutAddresses)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FProgramDerivedAccount::FindProgramAddresses)
+
+	OutAddresses.Reset();
+	OutAddresses.SetNum(Queries.Num());
+
+	TArray<FAddressCacheKey> Keys;
+	Keys.SetNum(Queries.Num());
+	TArray<int32> Misses;
+
+	// Cached addresses are served under a single lock, the rest is derived in parallel without holding it.
+	FAddressCache& Cache = GetAddressCache();
+	{
+		FScopeLock ScopeLock(&Cache.Lock);
+		for (int32 Index = 0; Index < Queries.Num(); ++Index)
+		{
+			if (!AreSeedsValid(Queries[Index].Seeds, MaxSeeds - 1)) { continue; }
+
+			Keys[Index] = FAddressCacheKey(Queries[Index].Seeds, Queries[Index].ProgramId);
+			if (const FProgramAddress* Cached = Cache.Entries.FindAndTouch(Keys[Index]))
+			{
+				OutAddresses[Index] = *Cached;
+			}
+			else
+			{
+				Misses.Add(Index);
+			}
+		}
+	}
+
+	// Bump 255 is off the curve for half of all seeds, its candidates are hashed as one batch and only the misses
+	// that land on the curve search further.
+	int32 CandidatesSize = 0;
+	for (const int32 Index : Misses)
+	{
+		CandidatesSize += 1 + FPublicKey::Size + sizeof(ProgramDerivedAddressMarker) - 1;
+		for (const TArray<uint8>& Seed : Queries[Index].Seeds) { CandidatesSize += Seed.Num(); }
+	}
+
+	TArray<uint8>                  Candidates;
+	TArray<TConstArrayView<uint8>> CandidateViews;
+	TArray<uint8>                  Hashes;
+	Candidates.Reserve(CandidatesSize);
+	CandidateViews.Reserve(Misses.Num());
+	Hashes.SetNumUninitialized(Misses.Num() * FHashBatch::SHA256Size);
+	for (const int32 Index : Misses)
+	{
+		const int32 Start = Candidates.Num();
+		for (const TArray<uint8>& Seed : Queries[Index].Seeds) { Candidates.Append(Seed); }
+		Candidates.Add(255);
+		Candidates.Append(Queries[Index].ProgramId.GetData(), FPublicKey::Size);
+		Candidates.Append(reinterpret_cast<const uint8*>(ProgramDerivedAddressMarker), sizeof(ProgramDerivedAddressMarker) - 1);
+		CandidateViews.Add(TConstArrayView<uint8>(Candidates.GetData() + Start, Candidates.Num() - Start));
+	}
+	FHashBatch::SHA256(CandidateViews, Hashes.GetData());
+
+	ParallelFor(Misses.Num(), [&](int32 MissIndex)
+	{
+		const int32  Index = Misses[MissIndex];
+		const uint8* Hash = Hashes.GetData() + MissIndex * FHashBatch::SHA256Size;
+		if (is_point_on_curve(Hash))
+		{
+			OutAddresses[Index] = DeriveProgramAddress(Queries[Index].Seeds, Queries[Index].ProgramId, 254);
+		}
+		else
+		{
+			OutAddresses[Index].Address = FPublicKey(Hash, FPublicKey::Size);
+			OutAddresses[Index].Bump = 255;
+		}
+	});
+
+	FScopeLock ScopeLock(&Cache.Lock);
+	for (const int32 Index : Misses)
+	{
+		if (OutAddresses[Index].IsValid()) { Cache.Entries.Add(Keys[Index], OutAddresses[Index]); }
+	}
+}
+
+void FProgramDerivedAccount::SetCacheCapacity(int32 Capacity)
+{
+	FAddressCache& Cache = GetAddressCache();
+	FScopeLock     ScopeLock(&Cache.Lock);
+	Cache.Entries.Empty(FMath::Max(Capacity, 1));
+}
+
+void FProgramDerivedAccount::ClearCache()
+{
+	FAddressCache& Cache = GetAddressCache();
+	FScopeLock     ScopeLock(&Cache.Lock);
+	Cache.Entries.Empty(Cache.Entries.Max());
+}
+
+TTuple<FString, int32> FProgramDerivedAccount::FindProgramAddress(const TArray<TArray<uint8>>& Seeds, const TArray<uint8>& ProgramId)
+{
+	if (ProgramId.Num() != FPublicKey::Size)
+	{
+		UE_LOG(LogTemp, Error, TEXT("Program id must be %d bytes"), FPublicKey::Size);
+		return MakeTuple(FString(), -1);
+	}
+
+	const FProgramAddress Result = FindProgramAddress(Seeds, FPublicKey(ProgramId));
+	if (!Result.IsValid()) { return MakeTuple(FString(), -1); }
+
+	return MakeTuple(Result.Address.ToBase58(), Result.Bump);
+}
+
+TTuple<FString, int32> FProgramDerivedAccount::FindProgramAddress(const TArray<FString>& Seeds, const TArray<uint8>& ProgramId)
+{
+	TArray<TArray<uint8>> SeedByteArrays;
+
+	for (const FString& Seed : Seeds)
+	{
+		SeedByteArrays.Add(StringToByteArray(Seed));
+	}
+
+	return FindProgramAddress(SeedByteArrays, ProgramId);
+}
+
+TArray<uint8> FProgramDerivedAccount::StringToByteArray(FString InString)
+{
+	const auto UTF8String = StringCast<ANSICHAR>(*InString);
+	const ANSICHAR* UTF8CharArray = UTF8String.Get();
+
+	TArray<uint8> ByteArray;
+	for (int32 Index = 0; Index < UTF8String.Length(); ++Index)
+	{
+		ByteArray.Add(static_cast<uint8>(UTF8CharArray[Index]));
+	}
+
+	return ByteArray;
+}
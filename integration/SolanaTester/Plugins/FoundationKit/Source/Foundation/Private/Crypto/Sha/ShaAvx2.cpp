@@ -0,0 +1,87 @@
+/*
+Copyright 2022 ATMTA, Inc.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+	http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+#include "ShaKernels.h"
+
+#if PLATFORM_CPU_X86_FAMILY
+
+#include <immintrin.h>
+
+// Only the functions of this file may use AVX2, they run after FShaKernels checked the CPU has it.
+#if defined(__clang__)
+#pragma clang attribute push(__attribute__((target("avx2"))), apply_to = function)
+#elif defined(__GNUC__)
+#pragma GCC push_options
+#pragma GCC target("avx2")
+#endif
+
+#include "ShaMultiBuffer.h"
+
+namespace
+{
+	struct FAvx2Ops32
+	{
+		using FWord = uint32;
+		using FVector = __m256i;
+		static constexpr int32 Lanes = 8;
+
+		static FORCEINLINE FVector Load(const FWord* Words) { return _mm256_load_si256(reinterpret_cast<const __m256i*>(Words)); }
+		static FORCEINLINE void    Store(FWord* Words, FVector V) { _mm256_store_si256(reinterpret_cast<__m256i*>(Words), V); }
+		static FORCEINLINE FVector Splat(FWord Word) { return _mm256_set1_epi32(static_cast<int32>(Word)); }
+		static FORCEINLINE FVector Add(FVector A, FVector B) { return _mm256_add_epi32(A, B); }
+		static FORCEINLINE FVector Xor(FVector A, FVector B) { return _mm256_xor_si256(A, B); }
+		static FORCEINLINE FVector And(FVector A, FVector B) { return _mm256_and_si256(A, B); }
+		static FORCEINLINE FVector Or(FVector A, FVector B) { return _mm256_or_si256(A, B); }
+		static FORCEINLINE FVector AndNot(FVector A, FVector B) { return _mm256_andnot_si256(A, B); }
+		template <int32 N> static FORCEINLINE FVector Shr(FVector V) { return _mm256_srli_epi32(V, N); }
+		template <int32 N> static FORCEINLINE FVector Shl(FVector V) { return _mm256_slli_epi32(V, N); }
+	};
+
+	struct FAvx2Ops64
+	{
+		using FWord = uint64;
+		using FVector = __m256i;
+		static constexpr int32 Lanes = 4;
+
+		static FORCEINLINE FVector Load(const FWord* Words) { return _mm256_load_si256(reinterpret_cast<const __m256i*>(Words)); }
+		static FORCEINLINE void    Store(FWord* Words, FVector V) { _mm256_store_si256(reinterpret_cast<__m256i*>(Words), V); }
+		static FORCEINLINE FVector Splat(FWord Word) { return _mm256_set1_epi64x(static_cast<int64>(Word)); }
+		static FORCEINLINE FVector Add(FVector A, FVector B) { return _mm256_add_epi64(A, B); }
+		static FORCEINLINE FVector Xor(FVector A, FVector B) { return _mm256_xor_si256(A, B); }
+		static FORCEINLINE FVector And(FVector A, FVector B) { return _mm256_and_si256(A, B); }
+		static FORCEINLINE FVector Or(FVector A, FVector B) { return _mm256_or_si256(A, B); }
+		static FORCEINLINE FVector AndNot(FVector A, FVector B) { return _mm256_andnot_si256(A, B); }
+		template <int32 N> static FORCEINLINE FVector Shr(FVector V) { return _mm256_srli_epi64(V, N); }
+		template <int32 N> static FORCEINLINE FVector Shl(FVector V) { return _mm256_slli_epi64(V, N); }
+	};
+} // namespace
+
+void Sha256CompressAvx2(uint32* States, const uint8* const* Lanes, int32 NumBlocks)
+{
+	ShaMultiBuffer::Sha256Compress<FAvx2Ops32>(States, Lanes, NumBlocks);
+}
+
+void Sha512CompressAvx2(uint64* States, const uint8* const* Lanes, int32 NumBlocks)
+{
+	ShaMultiBuffer::Sha512Compress<FAvx2Ops64>(States, Lanes, NumBlocks);
+}
+
+#if defined(__clang__)
+#pragma clang attribute pop
+#elif defined(__GNUC__)
+#pragma GCC pop_options
+#endif
+
+#endif
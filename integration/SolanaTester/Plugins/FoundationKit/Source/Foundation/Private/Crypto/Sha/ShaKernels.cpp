@@ -0,0 +1,226 @@
+/*
+Copyright 2022 ATMTA, Inc.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+	http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+#include "ShaKernels.h"
+
+#if PLATFORM_CPU_X86_FAMILY
+#if PLATFORM_WINDOWS
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+#endif
+
+const uint64 Sha512RoundConstants[80] = {
+	0x428a2f98d728ae22ULL, 0x7137449123ef65cdULL, 0xb5c0fbcfec4d3b2fULL, 0xe9b5dba58189dbbcULL,
+	0x3956c25bf348b538ULL, 0x59f111f1b605d019ULL, 0x923f82a4af194f9bULL, 0xab1c5ed5da6d8118ULL,
+	0xd807aa98a3030242ULL, 0x12835b0145706fbeULL, 0x243185be4ee4b28cULL, 0x550c7dc3d5ffb4e2ULL,
+	0x72be5d74f27b896fULL, 0x80deb1fe3b1696b1ULL, 0x9bdc06a725c71235ULL, 0xc19bf174cf692694ULL,
+	0xe49b69c19ef14ad2ULL, 0xefbe4786384f25e3ULL, 0x0fc19dc68b8cd5b5ULL, 0x240ca1cc77ac9c65ULL,
+	0x2de92c6f592b0275ULL, 0x4a7484aa6ea6e483ULL, 0x5cb0a9dcbd41fbd4ULL, 0x76f988da831153b5ULL,
+	0x983e5152ee66dfabULL, 0xa831c66d2db43210ULL, 0xb00327c898fb213fULL, 0xbf597fc7beef0ee4ULL,
+	0xc6e00bf33da88fc2ULL, 0xd5a79147930aa725ULL, 0x06ca6351e003826fULL, 0x142929670a0e6e70ULL,
+	0x27b70a8546d22ffcULL, 0x2e1b21385c26c926ULL, 0x4d2c6dfc5ac42aedULL, 0x53380d139d95b3dfULL,
+	0x650a73548baf63deULL, 0x766a0abb3c77b2a8ULL, 0x81c2c92e47edaee6ULL, 0x92722c851482353bULL,
+	0xa2bfe8a14cf10364ULL, 0xa81a664bbc423001ULL, 0xc24b8b70d0f89791ULL, 0xc76c51a30654be30ULL,
+	0xd192e819d6ef5218ULL, 0xd69906245565a910ULL, 0xf40e35855771202aULL, 0x106aa07032bbd1b8ULL,
+	0x19a4c116b8d2d0c8ULL, 0x1e376c085141ab53ULL, 0x2748774cdf8eeb99ULL, 0x34b0bcb5e19b48a8ULL,
+	0x391c0cb3c5c95a63ULL, 0x4ed8aa4ae3418acbULL, 0x5b9cca4f7763e373ULL, 0x682e6ff3d6b2b8a3ULL,
+	0x748f82ee5defb2fcULL, 0x78a5636f43172f60ULL, 0x84c87814a1f0ab72ULL, 0x8cc702081a6439ecULL,
+	0x90befffa23631e28ULL, 0xa4506cebde82bde9ULL, 0xbef9a3f7b2c67915ULL, 0xc67178f2e372532bULL,
+	0xca273eceea26619cULL, 0xd186b8c721c0c207ULL, 0xeada7dd6cde0eb1eULL, 0xf57d4f7fee6ed178ULL,
+	0x06f067aa72176fbaULL, 0x0a637dc5a2c898a6ULL, 0x113f9804bef90daeULL, 0x1b710b35131c471bULL,
+	0x28db77f523047d84ULL, 0x32caab7b40c72493ULL, 0x3c9ebe0a15c9bebcULL, 0x431d67c49c100d4cULL,
+	0x4cc5d4becb3e42b6ULL, 0x597f299cfc657e2aULL, 0x5fcb6fab3ad6faecULL, 0x6c44198c4a475817ULL,
+};
+
+namespace
+{
+	template <typename T>
+	FORCEINLINE T Rotr(T Value, int32 N) { return Value >> N | Value << (sizeof(T) * 8 - N); }
+
+	template <typename T>
+	T LoadBE(const uint8* Bytes)
+	{
+		T Value = 0;
+		for (int32 i = 0; i < static_cast<int32>(sizeof(T)); i++) { Value = Value << 8 | Bytes[i]; }
+		return Value;
+	}
+
+#if PLATFORM_CPU_X86_FAMILY
+	void Cpuid(uint32 Leaf, uint32 SubLeaf, uint32 OutRegisters[4])
+	{
+#if PLATFORM_WINDOWS
+		int32 Registers[4];
+		__cpuidex(Registers, Leaf, SubLeaf);
+		FMemory::Memcpy(OutRegisters, Registers, sizeof(Registers));
+#else
+		__cpuid_count(Leaf, SubLeaf, OutRegisters[0], OutRegisters[1], OutRegisters[2], OutRegisters[3]);
+#endif
+	}
+
+	// The register state the OS saves on context switches, AVX needs the XMM and YMM bits.
+	uint64 GetEnabledRegisterState()
+	{
+#if PLATFORM_WINDOWS
+		return _xgetbv(0);
+#else
+		uint32 Low, High;
+		__asm__ volatile("xgetbv" : "=a"(Low), "=d"(High) : "c"(0));
+		return static_cast<uint64>(High) << 32 | Low;
+#endif
+	}
+
+	void DetectX86Kernels(FShaKernels& Kernels)
+	{
+		uint32 Registers[4];
+		Cpuid(0, 0, Registers);
+		if (Registers[0] < 7) { return; }
+
+		Cpuid(1, 0, Registers);
+		const bool bSsse3 = (Registers[2] & 1 << 9) != 0;
+		const bool bSse41 = (Registers[2] & 1 << 19) != 0;
+		const bool bAvxEnabled = (Registers[2] & 1 << 27) != 0 && (Registers[2] & 1 << 28) != 0 && (GetEnabledRegisterState() & 0x6) == 0x6;
+
+		Cpuid(7, 0, Registers);
+		const bool bAvx2 = bAvxEnabled && (Registers[1] & 1 << 5) != 0;
+		const bool bShaNi = bSsse3 && bSse41 && (Registers[1] & 1 << 29) != 0;
+
+		// One SHA extension stream is faster than 8 AVX2 lanes, batches then go through it one input at a time.
+		if (bShaNi)
+		{
+			Kernels.Name256 = TEXT("SHA-NI");
+			Kernels.Compress256 = Sha256CompressShaNi;
+		}
+		else if (bAvx2)
+		{
+			Kernels.Name256 = TEXT("AVX2 x8");
+			Kernels.Compress256xN = Sha256CompressAvx2;
+			Kernels.Lanes256 = 8;
+		}
+
+		if (bAvx2)
+		{
+			Kernels.Name512 = TEXT("AVX2 x4");
+			Kernels.Compress512xN = Sha512CompressAvx2;
+			Kernels.Lanes512 = 4;
+		}
+	}
+#endif
+} // namespace
+
+void Sha256CompressScalar(uint32* State, const uint8* Blocks, int32 NumBlocks)
+{
+	for (int32 Block = 0; Block < NumBlocks; Block++, Blocks += 64)
+	{
+		uint32 W[64];
+		for (int32 t = 0; t < 16; t++) { W[t] = LoadBE<uint32>(Blocks + t * 4); }
+		for (int32 t = 16; t < 64; t++)
+		{
+			const uint32 S0 = Rotr(W[t - 15], 7) ^ Rotr(W[t - 15], 18) ^ W[t - 15] >> 3;
+			const uint32 S1 = Rotr(W[t - 2], 17) ^ Rotr(W[t - 2], 19) ^ W[t - 2] >> 10;
+			W[t] = W[t - 16] + S0 + W[t - 7] + S1;
+		}
+
+		uint32 A = State[0], B = State[1], C = State[2], D = State[3], E = State[4], F = State[5], G = State[6], H = State[7];
+		for (int32 t = 0; t < 64; t++)
+		{
+			const uint32 T1 = H + (Rotr(E, 6) ^ Rotr(E, 11) ^ Rotr(E, 25)) + (E & F ^ ~E & G) + Sha256RoundConstants[t] + W[t];
+			const uint32 T2 = (Rotr(A, 2) ^ Rotr(A, 13) ^ Rotr(A, 22)) + (A & B | C & (A | B));
+			H = G;
+			G = F;
+			F = E;
+			E = D + T1;
+			D = C;
+			C = B;
+			B = A;
+			A = T1 + T2;
+		}
+
+		State[0] += A;
+		State[1] += B;
+		State[2] += C;
+		State[3] += D;
+		State[4] += E;
+		State[5] += F;
+		State[6] += G;
+		State[7] += H;
+	}
+}
+
+void Sha512CompressScalar(uint64* State, const uint8* Blocks, int32 NumBlocks)
+{
+	for (int32 Block = 0; Block < NumBlocks; Block++, Blocks += 128)
+	{
+		uint64 W[80];
+		for (int32 t = 0; t < 16; t++) { W[t] = LoadBE<uint64>(Blocks + t * 8); }
+		for (int32 t = 16; t < 80; t++)
+		{
+			const uint64 S0 = Rotr(W[t - 15], 1) ^ Rotr(W[t - 15], 8) ^ W[t - 15] >> 7;
+			const uint64 S1 = Rotr(W[t - 2], 19) ^ Rotr(W[t - 2], 61) ^ W[t - 2] >> 6;
+			W[t] = W[t - 16] + S0 + W[t - 7] + S1;
+		}
+
+		uint64 A = State[0], B = State[1], C = State[2], D = State[3], E = State[4], F = State[5], G = State[6], H = State[7];
+		for (int32 t = 0; t < 80; t++)
+		{
+			const uint64 T1 = H + (Rotr(E, 14) ^ Rotr(E, 18) ^ Rotr(E, 41)) + (E & F ^ ~E & G) + Sha512RoundConstants[t] + W[t];
+			const uint64 T2 = (Rotr(A, 28) ^ Rotr(A, 34) ^ Rotr(A, 39)) + (A & B | C & (A | B));
+			H = G;
+			G = F;
+			F = E;
+			E = D + T1;
+			D = C;
+			C = B;
+			B = A;
+			A = T1 + T2;
+		}
+
+		State[0] += A;
+		State[1] += B;
+		State[2] += C;
+		State[3] += D;
+		State[4] += E;
+		State[5] += F;
+		State[6] += G;
+		State[7] += H;
+	}
+}
+
+const FShaKernels& FShaKernels::Get()
+{
+	static const FShaKernels Kernels = []
+	{
+		FShaKernels Detected;
+		Detected.Compress256 = Sha256CompressScalar;
+		Detected.Compress512 = Sha512CompressScalar;
+
+#if PLATFORM_CPU_X86_FAMILY
+		DetectX86Kernels(Detected);
+#elif SHA_KERNELS_NEON
+		// NEON is part of every 64-bit ARM CPU.
+		Detected.Name256 = TEXT("NEON x4");
+		Detected.Compress256xN = Sha256CompressNeon;
+		Detected.Lanes256 = 4;
+		Detected.Name512 = TEXT("NEON x2");
+		Detected.Compress512xN = Sha512CompressNeon;
+		Detected.Lanes512 = 2;
+#endif
+
+		UE_LOG(LogTemp, Log, TEXT("SHA-256 kernel: %s, SHA-512 kernel: %s"), Detected.Name256, Detected.Name512);
+		return Detected;
+	}();
+	return Kernels;
+}
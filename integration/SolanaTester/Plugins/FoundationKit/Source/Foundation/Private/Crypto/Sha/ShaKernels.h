@@ -0,0 +1,70 @@
+/*
+Copyright 2022 ATMTA, Inc.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+	http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Crypto/ConstexprSha256.h"
+
+/**
+ * The SHA-256 and SHA-512 compression functions behind FHashBatch. Kernels work on whole, already padded blocks:
+ * single buffer ones on consecutive blocks of one message, multi buffer ones on the same number of blocks from every
+ * lane at once.
+ */
+struct FShaKernels
+{
+	// Compresses NumBlocks consecutive blocks into the 8 words of State.
+	using FCompress256 = void (*)(uint32* State, const uint8* Blocks, int32 NumBlocks);
+	using FCompress512 = void (*)(uint64* State, const uint8* Blocks, int32 NumBlocks);
+
+	// Compresses NumBlocks blocks of every lane. States holds the 8 words of lane 0, then those of lane 1 and so on.
+	using FCompress256xN = void (*)(uint32* States, const uint8* const* Lanes, int32 NumBlocks);
+	using FCompress512xN = void (*)(uint64* States, const uint8* const* Lanes, int32 NumBlocks);
+
+	const TCHAR*   Name256 = TEXT("scalar");
+	FCompress256   Compress256 = nullptr;
+	FCompress256xN Compress256xN = nullptr;
+	int32          Lanes256 = 1;
+
+	const TCHAR*   Name512 = TEXT("scalar");
+	FCompress512   Compress512 = nullptr;
+	FCompress512xN Compress512xN = nullptr;
+	int32          Lanes512 = 1;
+
+	// The fastest kernels the running CPU supports, detected on first use.
+	static const FShaKernels& Get();
+};
+
+// The NEON kernels use AArch64 intrinsics, 32-bit ARM and platforms built without NEON intrinsics stay on the scalar ones.
+#define SHA_KERNELS_NEON (PLATFORM_CPU_ARM_FAMILY && PLATFORM_64BITS && PLATFORM_ENABLE_VECTORINTRINSICS_NEON)
+
+// The SHA-256 table is shared with the compile time hash.
+inline constexpr const uint32 (&Sha256RoundConstants)[64] = ConstexprSha256::RoundConstants;
+extern const uint64 Sha512RoundConstants[80];
+
+void Sha256CompressScalar(uint32* State, const uint8* Blocks, int32 NumBlocks);
+void Sha512CompressScalar(uint64* State, const uint8* Blocks, int32 NumBlocks);
+
+#if PLATFORM_CPU_X86_FAMILY
+// SHA extensions, one message at a time.
+void Sha256CompressShaNi(uint32* State, const uint8* Blocks, int32 NumBlocks);
+// 8 SHA-256 or 4 SHA-512 lanes.
+void Sha256CompressAvx2(uint32* States, const uint8* const* Lanes, int32 NumBlocks);
+void Sha512CompressAvx2(uint64* States, const uint8* const* Lanes, int32 NumBlocks);
+#elif SHA_KERNELS_NEON
+// 4 SHA-256 or 2 SHA-512 lanes.
+void Sha256CompressNeon(uint32* States, const uint8* const* Lanes, int32 NumBlocks);
+void Sha512CompressNeon(uint64* States, const uint8* const* Lanes, int32 NumBlocks);
+#endif
@@ -0,0 +1,152 @@
+/*
+Copyright 2022 ATMTA, Inc.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+	http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+#pragma once
+
+#include "ShaKernels.h"
+
+/**
+ * SHA-256 and SHA-512 written once over a vector type holding one word per lane. Every lane runs the same rounds on
+ * its own message, so the code is the scalar algorithm with every operation applied lane-wise. Ops provides:
+ *
+ *   FWord, FVector, Lanes   the word and vector types, and the number of words a vector holds
+ *   Load, Store             from and to an array of Lanes words aligned to 32 bytes
+ *   Splat                   the same word in every lane
+ *   Add, Xor, And, Or       lane-wise
+ *   AndNot(A, B)            ~A & B
+ *   Shr<N>, Shl<N>          lane-wise shifts by a constant
+ *
+ * Included by the kernel files only, after they enable the instruction set the ops need.
+ */
+namespace ShaMultiBuffer
+{
+	inline uint32 LoadBE(const uint8* Bytes, uint32)
+	{
+		return static_cast<uint32>(Bytes[0]) << 24 | static_cast<uint32>(Bytes[1]) << 16 | static_cast<uint32>(Bytes[2]) << 8 | Bytes[3];
+	}
+
+	inline uint64 LoadBE(const uint8* Bytes, uint64)
+	{
+		return static_cast<uint64>(LoadBE(Bytes, uint32())) << 32 | LoadBE(Bytes + 4, uint32());
+	}
+
+	template <typename Ops, int32 N>
+	FORCEINLINE typename Ops::FVector Rotr(typename Ops::FVector V)
+	{
+		constexpr int32 Bits = sizeof(typename Ops::FWord) * 8;
+		return Ops::Or(Ops::template Shr<N>(V), Ops::template Shl<Bits - N>(V));
+	}
+
+	// Sigma functions of the rounds: three rotations, or two rotations and a shift.
+	template <typename Ops, int32 A, int32 B, int32 C>
+	struct TBigSigma
+	{
+		static FORCEINLINE typename Ops::FVector Apply(typename Ops::FVector V)
+		{
+			return Ops::Xor(Ops::Xor(Rotr<Ops, A>(V), Rotr<Ops, B>(V)), Rotr<Ops, C>(V));
+		}
+	};
+
+	template <typename Ops, int32 A, int32 B, int32 C>
+	struct TSmallSigma
+	{
+		static FORCEINLINE typename Ops::FVector Apply(typename Ops::FVector V)
+		{
+			return Ops::Xor(Ops::Xor(Rotr<Ops, A>(V), Rotr<Ops, B>(V)), Ops::template Shr<C>(V));
+		}
+	};
+
+	// The compression shared by both hashes, Rounds rounds over blocks of 16 words.
+	template <typename Ops, int32 Rounds, typename BigSigma0, typename BigSigma1, typename SmallSigma0, typename SmallSigma1>
+	void Compress(typename Ops::FWord* States, const uint8* const* Lanes, int32 NumBlocks, const typename Ops::FWord* RoundConstants)
+	{
+		using FWord = typename Ops::FWord;
+		using FVector = typename Ops::FVector;
+		constexpr int32 BlockSize = 16 * sizeof(FWord);
+
+		alignas(32) FWord Words[Ops::Lanes];
+
+		FVector State[8];
+		for (int32 i = 0; i < 8; i++)
+		{
+			for (int32 Lane = 0; Lane < Ops::Lanes; Lane++) { Words[Lane] = States[Lane * 8 + i]; }
+			State[i] = Ops::Load(Words);
+		}
+
+		for (int32 Block = 0; Block < NumBlocks; Block++)
+		{
+			FVector W[16];
+			for (int32 t = 0; t < 16; t++)
+			{
+				for (int32 Lane = 0; Lane < Ops::Lanes; Lane++) { Words[Lane] = LoadBE(Lanes[Lane] + Block * BlockSize + t * sizeof(FWord), FWord()); }
+				W[t] = Ops::Load(Words);
+			}
+
+			FVector A = State[0], B = State[1], C = State[2], D = State[3];
+			FVector E = State[4], F = State[5], G = State[6], H = State[7];
+			for (int32 t = 0; t < Rounds; t++)
+			{
+				if (t >= 16)
+				{
+					W[t & 15] = Ops::Add(Ops::Add(W[t & 15], SmallSigma0::Apply(W[(t + 1) & 15])),
+						Ops::Add(W[(t + 9) & 15], SmallSigma1::Apply(W[(t + 14) & 15])));
+				}
+
+				const FVector Choose = Ops::Xor(Ops::And(E, F), Ops::AndNot(E, G));
+				const FVector Majority = Ops::Or(Ops::And(A, B), Ops::And(C, Ops::Or(A, B)));
+				const FVector T1 = Ops::Add(Ops::Add(Ops::Add(H, BigSigma1::Apply(E)), Ops::Add(Choose, Ops::Splat(RoundConstants[t]))), W[t & 15]);
+				const FVector T2 = Ops::Add(BigSigma0::Apply(A), Majority);
+
+				H = G;
+				G = F;
+				F = E;
+				E = Ops::Add(D, T1);
+				D = C;
+				C = B;
+				B = A;
+				A = Ops::Add(T1, T2);
+			}
+
+			State[0] = Ops::Add(State[0], A);
+			State[1] = Ops::Add(State[1], B);
+			State[2] = Ops::Add(State[2], C);
+			State[3] = Ops::Add(State[3], D);
+			State[4] = Ops::Add(State[4], E);
+			State[5] = Ops::Add(State[5], F);
+			State[6] = Ops::Add(State[6], G);
+			State[7] = Ops::Add(State[7], H);
+		}
+
+		for (int32 i = 0; i < 8; i++)
+		{
+			Ops::Store(Words, State[i]);
+			for (int32 Lane = 0; Lane < Ops::Lanes; Lane++) { States[Lane * 8 + i] = Words[Lane]; }
+		}
+	}
+
+	template <typename Ops>
+	void Sha256Compress(uint32* States, const uint8* const* Lanes, int32 NumBlocks)
+	{
+		Compress<Ops, 64, TBigSigma<Ops, 2, 13, 22>, TBigSigma<Ops, 6, 11, 25>, TSmallSigma<Ops, 7, 18, 3>, TSmallSigma<Ops, 17, 19, 10>>(
+			States, Lanes, NumBlocks, Sha256RoundConstants);
+	}
+
+	template <typename Ops>
+	void Sha512Compress(uint64* States, const uint8* const* Lanes, int32 NumBlocks)
+	{
+		Compress<Ops, 80, TBigSigma<Ops, 28, 34, 39>, TBigSigma<Ops, 14, 18, 41>, TSmallSigma<Ops, 1, 8, 7>, TSmallSigma<Ops, 19, 61, 6>>(
+			States, Lanes, NumBlocks, Sha512RoundConstants);
+	}
+} // namespace ShaMultiBuffer
@@ -0,0 +1,74 @@
+/*
+Copyright 2022 ATMTA, Inc.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+	http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+#include "ShaKernels.h"
+
+#if SHA_KERNELS_NEON
+
+#include <arm_neon.h>
+
+#include "ShaMultiBuffer.h"
+
+namespace
+{
+	struct FNeonOps32
+	{
+		using FWord = uint32;
+		using FVector = uint32x4_t;
+		static constexpr int32 Lanes = 4;
+
+		static FORCEINLINE FVector Load(const FWord* Words) { return vld1q_u32(Words); }
+		static FORCEINLINE void    Store(FWord* Words, FVector V) { vst1q_u32(Words, V); }
+		static FORCEINLINE FVector Splat(FWord Word) { return vdupq_n_u32(Word); }
+		static FORCEINLINE FVector Add(FVector A, FVector B) { return vaddq_u32(A, B); }
+		static FORCEINLINE FVector Xor(FVector A, FVector B) { return veorq_u32(A, B); }
+		static FORCEINLINE FVector And(FVector A, FVector B) { return vandq_u32(A, B); }
+		static FORCEINLINE FVector Or(FVector A, FVector B) { return vorrq_u32(A, B); }
+		// vbic clears the bits of its second operand.
+		static FORCEINLINE FVector AndNot(FVector A, FVector B) { return vbicq_u32(B, A); }
+		template <int32 N> static FORCEINLINE FVector Shr(FVector V) { return vshrq_n_u32(V, N); }
+		template <int32 N> static FORCEINLINE FVector Shl(FVector V) { return vshlq_n_u32(V, N); }
+	};
+
+	struct FNeonOps64
+	{
+		using FWord = uint64;
+		using FVector = uint64x2_t;
+		static constexpr int32 Lanes = 2;
+
+		static FORCEINLINE FVector Load(const FWord* Words) { return vld1q_u64(Words); }
+		static FORCEINLINE void    Store(FWord* Words, FVector V) { vst1q_u64(Words, V); }
+		static FORCEINLINE FVector Splat(FWord Word) { return vdupq_n_u64(Word); }
+		static FORCEINLINE FVector Add(FVector A, FVector B) { return vaddq_u64(A, B); }
+		static FORCEINLINE FVector Xor(FVector A, FVector B) { return veorq_u64(A, B); }
+		static FORCEINLINE FVector And(FVector A, FVector B) { return vandq_u64(A, B); }
+		static FORCEINLINE FVector Or(FVector A, FVector B) { return vorrq_u64(A, B); }
+		static FORCEINLINE FVector AndNot(FVector A, FVector B) { return vbicq_u64(B, A); }
+		template <int32 N> static FORCEINLINE FVector Shr(FVector V) { return vshrq_n_u64(V, N); }
+		template <int32 N> static FORCEINLINE FVector Shl(FVector V) { return vshlq_n_u64(V, N); }
+	};
+} // namespace
+
+void Sha256CompressNeon(uint32* States, const uint8* const* Lanes, int32 NumBlocks)
+{
+	ShaMultiBuffer::Sha256Compress<FNeonOps32>(States, Lanes, NumBlocks);
+}
+
+void Sha512CompressNeon(uint64* States, const uint8* const* Lanes, int32 NumBlocks)
+{
+	ShaMultiBuffer::Sha512Compress<FNeonOps64>(States, Lanes, NumBlocks);
+}
+
+#endif
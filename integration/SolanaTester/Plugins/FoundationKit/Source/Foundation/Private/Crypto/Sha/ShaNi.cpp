@@ -0,0 +1,84 @@
+/*
+Copyright 2022 ATMTA, Inc.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+	http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+#include "ShaKernels.h"
+
+#if PLATFORM_CPU_X86_FAMILY
+
+#include <immintrin.h>
+
+// Only the functions of this file may use the SHA extensions, they run after FShaKernels checked the CPU has them.
+#if defined(__clang__)
+#pragma clang attribute push(__attribute__((target("sha,sse4.1"))), apply_to = function)
+#elif defined(__GNUC__)
+#pragma GCC push_options
+#pragma GCC target("sha,sse4.1")
+#endif
+
+void Sha256CompressShaNi(uint32* State, const uint8* Blocks, int32 NumBlocks)
+{
+	const __m128i ByteSwap = _mm_set_epi64x(0x0c0d0e0f08090a0bULL, 0x0405060700010203ULL);
+
+	// The rounds instruction keeps the state as ABEF and CDGH.
+	__m128i Tmp = _mm_shuffle_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(State)), 0xB1);
+	__m128i State1 = _mm_shuffle_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(State + 4)), 0x1B);
+	__m128i State0 = _mm_alignr_epi8(Tmp, State1, 8);
+	State1 = _mm_blend_epi16(State1, Tmp, 0xF0);
+
+	for (int32 Block = 0; Block < NumBlocks; Block++, Blocks += 64)
+	{
+		const __m128i SavedState0 = State0;
+		const __m128i SavedState1 = State1;
+
+		// Message words in groups of 4, Message[g % 4] holds group g while its rounds run.
+		__m128i Message[4];
+		for (int32 Group = 0; Group < 16; Group++)
+		{
+			__m128i& Current = Message[Group & 3];
+			if (Group < 4)
+			{
+				Current = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(Blocks + Group * 16)), ByteSwap);
+			}
+			else
+			{
+				// Current still holds group - 4.
+				const __m128i& Previous = Message[(Group - 1) & 3];
+				Tmp = _mm_sha256msg1_epu32(Current, Message[(Group - 3) & 3]);
+				Tmp = _mm_add_epi32(Tmp, _mm_alignr_epi8(Previous, Message[(Group - 2) & 3], 4));
+				Current = _mm_sha256msg2_epu32(Tmp, Previous);
+			}
+
+			const __m128i Words = _mm_add_epi32(Current, _mm_loadu_si128(reinterpret_cast<const __m128i*>(Sha256RoundConstants + Group * 4)));
+			State1 = _mm_sha256rnds2_epu32(State1, State0, Words);
+			State0 = _mm_sha256rnds2_epu32(State0, State1, _mm_shuffle_epi32(Words, 0x0E));
+		}
+
+		State0 = _mm_add_epi32(State0, SavedState0);
+		State1 = _mm_add_epi32(State1, SavedState1);
+	}
+
+	Tmp = _mm_shuffle_epi32(State0, 0x1B);
+	State1 = _mm_shuffle_epi32(State1, 0xB1);
+	_mm_storeu_si128(reinterpret_cast<__m128i*>(State), _mm_blend_epi16(Tmp, State1, 0xF0));
+	_mm_storeu_si128(reinterpret_cast<__m128i*>(State + 4), _mm_alignr_epi8(State1, Tmp, 8));
+}
+
+#if defined(__clang__)
+#pragma clang attribute pop
+#elif defined(__GNUC__)
+#pragma GCC pop_options
+#endif
+
+#endif
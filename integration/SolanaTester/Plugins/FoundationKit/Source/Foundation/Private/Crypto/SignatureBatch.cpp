@@ -0,0 +1,121 @@
+/*
+Copyright 2022 ATMTA, Inc.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+	http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+#include "Crypto/SignatureBatch.h"
+
+#include "CryptoUtils.h"
+#include "Crypto/ed25519/ed25519.h"
+
+constexpr int32 SignatureSize = 64;
+constexpr int32 PublicKeySize = 32;
+
+// Bytes of randomness behind each coefficient of the linear combination.
+constexpr int32 CoefficientSize = 16;
+
+void FSignatureBatch::Reserve(int32 Num)
+{
+	Messages.Reserve(Num);
+	MessageSizes.Reserve(Num);
+	Signatures.Reserve(Num);
+	PublicKeys.Reserve(Num);
+}
+
+void FSignatureBatch::Reset()
+{
+	Messages.Reset();
+	MessageSizes.Reset();
+	Signatures.Reset();
+	PublicKeys.Reset();
+}
+
+void FSignatureBatch::Add(const uint8* Message, int32 MessageSize, const uint8* Signature, const uint8* PublicKey)
+{
+	Messages.Add(Message);
+	MessageSizes.Add(MessageSize);
+	Signatures.Add(Signature);
+	PublicKeys.Add(PublicKey);
+}
+
+void FSignatureBatch::Add(const TArray<uint8>& Message, const TArray<uint8>& Signature, const TArray<uint8>& PublicKey)
+{
+	check(Signature.Num() == SignatureSize && PublicKey.Num() == PublicKeySize);
+	Add(Message.GetData(), Message.Num(), Signature.GetData(), PublicKey.GetData());
+}
+
+bool FSignatureBatch::Verify(TArray<bool>& OutValid) const
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FSignatureBatch::Verify)
+
+	const int32 Count = Num();
+	OutValid.SetNumUninitialized(Count);
+	if (Count == 0)
+	{
+		return true;
+	}
+
+	TArray<int32> Valid;
+	Valid.SetNumUninitialized(Count);
+
+	bool bAllValid;
+	TArray<uint8> Coefficients;
+	if (FCryptoUtils::RandomBytes(Coefficients, Count * CoefficientSize))
+	{
+		bAllValid = ed25519_verify_batch(Signatures.GetData(), Messages.GetData(), MessageSizes.GetData(), PublicKeys.GetData(), Count,
+			Coefficients.GetData(), Valid.GetData()) != 0;
+	}
+	else
+	{
+		// Predictable coefficients would let forged signatures cancel out, check one by one instead.
+		UE_LOG(LogTemp, Warning, TEXT("FSignatureBatch: no randomness available, verifying %d signatures one by one"), Count);
+		bAllValid = true;
+		for (int32 i = 0; i < Count; i++)
+		{
+			Valid[i] = ed25519_verify_cofactored(Signatures[i], Messages[i], MessageSizes[i], PublicKeys[i]);
+			bAllValid &= Valid[i] != 0;
+		}
+	}
+
+	for (int32 i = 0; i < Count; i++)
+	{
+		OutValid[i] = Valid[i] != 0;
+	}
+	return bAllValid;
+}
+
+bool FSignatureBatch::Verify() const
+{
+	TArray<bool> Valid;
+	return Verify(Valid);
+}
+
+bool FSignatureBatch::VerifyStrict(TArray<bool>& OutValid) const
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FSignatureBatch::VerifyStrict)
+
+	OutValid.SetNumUninitialized(Num());
+	bool bAllValid = true;
+	for (int32 i = 0; i < Num(); i++)
+	{
+		OutValid[i] = ed25519_verify_strict(Signatures[i], Messages[i], MessageSizes[i], PublicKeys[i]) != 0;
+		bAllValid &= OutValid[i];
+	}
+	return bAllValid;
+}
+
+bool FSignatureBatch::VerifyStrict() const
+{
+	TArray<bool> Valid;
+	return VerifyStrict(Valid);
+}
@@ -0,0 +1,76 @@
+/*
+Copyright 2022 ATMTA, Inc.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+	http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+#include "Crypto/SigningKey.h"
+
+#include "Crypto/ed25519/ed25519.h"
+
+constexpr int32 KeypairSize = 64;
+constexpr int32 SeedSize = 32;
+
+FSigningKey::FSigningKey(const uint8* PrivateKey)
+{
+	ed25519_expand_private_key(Expanded, PrivateKey);
+	FMemory::Memcpy(PublicKey, PrivateKey + SeedSize, sizeof(PublicKey));
+	bValid = true;
+}
+
+FSigningKey::FSigningKey(const TArray<uint8>& PrivateKey)
+{
+	if (PrivateKey.Num() != KeypairSize)
+	{
+		UE_LOG(LogTemp, Error, TEXT("FSigningKey expects a %d byte private key, got %d"), KeypairSize, PrivateKey.Num());
+		return;
+	}
+	*this = FSigningKey(PrivateKey.GetData());
+}
+
+FSigningKey::~FSigningKey()
+{
+	FMemory::Memzero(Expanded, sizeof(Expanded));
+}
+
+void FSigningKey::Sign(const uint8* Message, int32 MessageSize, uint8* OutSignature) const
+{
+	check(bValid);
+	ed25519_sign_expanded(OutSignature, Message, MessageSize, PublicKey, Expanded);
+}
+
+TArray<uint8> FSigningKey::Sign(const TArray<uint8>& Message) const
+{
+	TArray<uint8> Signature;
+	Signature.SetNumUninitialized(SignatureSize);
+	Sign(Message.GetData(), Message.Num(), Signature.GetData());
+	return Signature;
+}
+
+void FSigningKey::SignMany(const uint8* const* Messages, const int32* MessageSizes, int32 Count, uint8* OutSignatures) const
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FSigningKey::SignMany)
+
+	for (int32 i = 0; i < Count; i++)
+	{
+		Sign(Messages[i], MessageSizes[i], OutSignatures + i * SignatureSize);
+	}
+}
+
+void FSigningKey::SignMany(const TArray<TArray<uint8>>& Messages, TArray<uint8>& OutSignatures) const
+{
+	OutSignatures.SetNumUninitialized(Messages.Num() * SignatureSize);
+	for (int32 i = 0; i < Messages.Num(); i++)
+	{
+		Sign(Messages[i].GetData(), Messages[i].Num(), OutSignatures.GetData() + i * SignatureSize);
+	}
+}
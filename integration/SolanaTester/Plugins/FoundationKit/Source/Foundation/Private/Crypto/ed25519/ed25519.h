@@ -28,8 +28,18 @@ void ED25519_DECLSPEC ed25519_create_keypair(unsigned char* public_key, unsigned
                                              const unsigned char* seed);
 void ED25519_DECLSPEC ed25519_sign(unsigned char* signature, const unsigned char* message, size_t message_len,
                                    const unsigned char* private_key);
+void ED25519_DECLSPEC ed25519_expand_private_key(unsigned char* expanded, const unsigned char* private_key);
+void ED25519_DECLSPEC ed25519_sign_expanded(unsigned char* signature, const unsigned char* message, size_t message_len,
+                                            const unsigned char* public_key, const unsigned char* expanded);
 int ED25519_DECLSPEC ed25519_verify(const unsigned char* signature, const unsigned char* message, size_t message_len,
                                     const unsigned char* public_key);
+int ED25519_DECLSPEC ed25519_verify_strict(const unsigned char* signature, const unsigned char* message, size_t message_len,
+                                           const unsigned char* public_key);
+int ED25519_DECLSPEC ed25519_verify_cofactored(const unsigned char* signature, const unsigned char* message, size_t message_len,
+                                               const unsigned char* public_key);
+int ED25519_DECLSPEC ed25519_verify_batch(const unsigned char* const* signatures, const unsigned char* const* messages,
+                                          const size_t* message_lens, const unsigned char* const* public_keys, size_t count,
+                                          const unsigned char* random, int* valid);
 void ED25519_DECLSPEC ed25519_add_scalar(unsigned char* public_key, unsigned char* private_key,
                                          const unsigned char* scalar);
 void ED25519_DECLSPEC ed25519_key_exchange(unsigned char* shared_secret, const unsigned char* public_key,
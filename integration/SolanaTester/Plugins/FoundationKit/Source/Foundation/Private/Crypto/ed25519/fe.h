@@ -4,16 +4,40 @@
 #include "fixedint.h"
 
 
+/*
+    ED25519_FE51 selects the radix 2^51 backend of fe51.c, which multiplies
+    through 128 bit products and is much faster on 64 bit CPUs. It is on
+    whenever the compiler has a 128 bit integer type, define ED25519_NO_FE51
+    to force the ref10 backend of fe.c.
+*/
+
+#ifndef ED25519_FE51
+#if defined(__SIZEOF_INT128__) && !defined(ED25519_NO_FE51)
+#define ED25519_FE51 1
+#else
+#define ED25519_FE51 0
+#endif
+#endif
+
+
 /*
     fe means field element.
     Here the field is \Z/(2^255-19).
-    An element t, entries t[0]...t[9], represents the integer
+
+    ref10: an element t, entries t[0]...t[9], represents the integer
     t[0]+2^26 t[1]+2^51 t[2]+2^77 t[3]+2^102 t[4]+...+2^230 t[9].
     Bounds on each t[i] vary depending on context.
-*/
 
+    radix 2^51: an element t, entries t[0]...t[4], represents the integer
+    t[0]+2^51 t[1]+2^102 t[2]+2^153 t[3]+2^204 t[4].
+    Every entry stays below 2^54.
+*/
 
+#if ED25519_FE51
+typedef uint64_t fe[5];
+#else
 typedef int32_t fe[10];
+#endif
 
 
 void fe_0(fe h);
@@ -0,0 +1,540 @@
+#include "fixedint.h"
+#include "fe.h"
+
+#if ED25519_FE51
+
+
+/*
+    Radix 2^51 field arithmetic. Limbs are kept below 2^54 so that every
+    product of two limbs, scaled by 19 and summed five times, fits in 128 bits.
+    fe_add leaves its result uncarried, everything else carries down to
+    limbs just above 2^51.
+*/
+
+typedef unsigned __int128 uint128_t;
+
+static const uint64_t mask51 = (((uint64_t) 1) << 51) - 1;
+
+
+/*
+    helper functions
+*/
+static uint64_t load_8(const unsigned char *in) {
+    uint64_t result;
+
+    result = (uint64_t) in[0];
+    result |= ((uint64_t) in[1]) << 8;
+    result |= ((uint64_t) in[2]) << 16;
+    result |= ((uint64_t) in[3]) << 24;
+    result |= ((uint64_t) in[4]) << 32;
+    result |= ((uint64_t) in[5]) << 40;
+    result |= ((uint64_t) in[6]) << 48;
+    result |= ((uint64_t) in[7]) << 56;
+
+    return result;
+}
+
+static void store_8(unsigned char *out, uint64_t in) {
+    int i;
+
+    for (i = 0; i < 8; ++i) {
+        out[i] = (unsigned char) (in >> (8 * i));
+    }
+}
+
+static void fe_carry_wide(fe h, uint128_t r0, uint128_t r1, uint128_t r2, uint128_t r3, uint128_t r4) {
+    uint64_t h0, h1, h2, h3, h4, carry;
+
+    r1 += (uint64_t) (r0 >> 51);
+    h0 = (uint64_t) r0 & mask51;
+    r2 += (uint64_t) (r1 >> 51);
+    h1 = (uint64_t) r1 & mask51;
+    r3 += (uint64_t) (r2 >> 51);
+    h2 = (uint64_t) r2 & mask51;
+    r4 += (uint64_t) (r3 >> 51);
+    h3 = (uint64_t) r3 & mask51;
+    carry = (uint64_t) (r4 >> 51);
+    h4 = (uint64_t) r4 & mask51;
+    h0 += carry * 19;
+    h1 += h0 >> 51;
+    h0 &= mask51;
+
+    h[0] = h0;
+    h[1] = h1;
+    h[2] = h2;
+    h[3] = h3;
+    h[4] = h4;
+}
+
+static void fe_carry(fe h) {
+    h[1] += h[0] >> 51;
+    h[0] &= mask51;
+    h[2] += h[1] >> 51;
+    h[1] &= mask51;
+    h[3] += h[2] >> 51;
+    h[2] &= mask51;
+    h[4] += h[3] >> 51;
+    h[3] &= mask51;
+    h[0] += 19 * (h[4] >> 51);
+    h[4] &= mask51;
+}
+
+
+/*
+    h = 0
+*/
+
+void fe_0(fe h) {
+    h[0] = 0;
+    h[1] = 0;
+    h[2] = 0;
+    h[3] = 0;
+    h[4] = 0;
+}
+
+
+/*
+    h = 1
+*/
+
+void fe_1(fe h) {
+    h[0] = 1;
+    h[1] = 0;
+    h[2] = 0;
+    h[3] = 0;
+    h[4] = 0;
+}
+
+
+/*
+    h = f + g
+    Can overlap h with f or g.
+*/
+
+void fe_add(fe h, const fe f, const fe g) {
+    h[0] = f[0] + g[0];
+    h[1] = f[1] + g[1];
+    h[2] = f[2] + g[2];
+    h[3] = f[3] + g[3];
+    h[4] = f[4] + g[4];
+}
+
+
+/*
+    Replace (f,g) with (g,g) if b == 1;
+    replace (f,g) with (f,g) if b == 0.
+
+    Preconditions: b in {0,1}.
+*/
+
+void fe_cmov(fe f, const fe g, unsigned int b) {
+    uint64_t mask = (uint64_t) 0 - (uint64_t) b;
+
+    f[0] ^= (f[0] ^ g[0]) & mask;
+    f[1] ^= (f[1] ^ g[1]) & mask;
+    f[2] ^= (f[2] ^ g[2]) & mask;
+    f[3] ^= (f[3] ^ g[3]) & mask;
+    f[4] ^= (f[4] ^ g[4]) & mask;
+}
+
+
+/*
+    Replace (f,g) with (g,f) if b == 1;
+    replace (f,g) with (f,g) if b == 0.
+
+    Preconditions: b in {0,1}.
+*/
+
+void fe_cswap(fe f, fe g, unsigned int b) {
+    uint64_t mask = (uint64_t) 0 - (uint64_t) b;
+    uint64_t x;
+    int i;
+
+    for (i = 0; i < 5; ++i) {
+        x = (f[i] ^ g[i]) & mask;
+        f[i] ^= x;
+        g[i] ^= x;
+    }
+}
+
+
+/*
+    h = f
+*/
+
+void fe_copy(fe h, const fe f) {
+    h[0] = f[0];
+    h[1] = f[1];
+    h[2] = f[2];
+    h[3] = f[3];
+    h[4] = f[4];
+}
+
+
+/*
+    Ignores top bit of s.
+*/
+
+void fe_frombytes(fe h, const unsigned char *s) {
+    h[0] = load_8(s) & mask51;
+    h[1] = (load_8(s + 6) >> 3) & mask51;
+    h[2] = (load_8(s + 12) >> 6) & mask51;
+    h[3] = (load_8(s + 19) >> 1) & mask51;
+    h[4] = (load_8(s + 24) >> 12) & mask51;
+}
+
+
+/*
+    Writes the unique representative of h in [0, p).
+*/
+
+void fe_tobytes(unsigned char *s, const fe h) {
+    uint64_t t[5];
+
+    fe_copy(t, h);
+    fe_carry(t);
+    fe_carry(t);
+
+    /* t is now below 2^255 with every limb carried, subtract p if t >= p */
+    t[0] += 19;
+    fe_carry(t);
+
+    /* t + 19 is now reduced, add 2^255 - 19 and drop bit 255 */
+    t[0] += mask51 + 1 - 19;
+    t[1] += mask51;
+    t[2] += mask51;
+    t[3] += mask51;
+    t[4] += mask51;
+
+    t[1] += t[0] >> 51;
+    t[0] &= mask51;
+    t[2] += t[1] >> 51;
+    t[1] &= mask51;
+    t[3] += t[2] >> 51;
+    t[2] &= mask51;
+    t[4] += t[3] >> 51;
+    t[3] &= mask51;
+    t[4] &= mask51;
+
+    store_8(s, t[0] | (t[1] << 51));
+    store_8(s + 8, (t[1] >> 13) | (t[2] << 38));
+    store_8(s + 16, (t[2] >> 26) | (t[3] << 25));
+    store_8(s + 24, (t[3] >> 39) | (t[4] << 12));
+}
+
+
+/*
+    return 1 if f is in {1,3,5,...,q-2}
+    return 0 if f is in {0,2,4,...,q-1}
+*/
+
+int fe_isnegative(const fe f) {
+    unsigned char s[32];
+
+    fe_tobytes(s, f);
+
+    return s[0] & 1;
+}
+
+
+/*
+    return 1 if f == 0
+    return 0 if f != 0
+*/
+
+int fe_isnonzero(const fe f) {
+    unsigned char s[32];
+    unsigned char r;
+    int i;
+
+    fe_tobytes(s, f);
+
+    r = 0;
+    for (i = 0; i < 32; ++i) {
+        r |= s[i];
+    }
+
+    return r != 0;
+}
+
+
+/*
+    h = f * g
+    Can overlap h with f or g.
+*/
+
+void fe_mul(fe h, const fe f, const fe g) {
+    uint64_t f0 = f[0], f1 = f[1], f2 = f[2], f3 = f[3], f4 = f[4];
+    uint64_t g0 = g[0], g1 = g[1], g2 = g[2], g3 = g[3], g4 = g[4];
+    uint64_t g1_19 = 19 * g1, g2_19 = 19 * g2, g3_19 = 19 * g3, g4_19 = 19 * g4;
+    uint128_t r0, r1, r2, r3, r4;
+
+    r0 = (uint128_t) f0 * g0 + (uint128_t) f1 * g4_19 + (uint128_t) f2 * g3_19 + (uint128_t) f3 * g2_19 + (uint128_t) f4 * g1_19;
+    r1 = (uint128_t) f0 * g1 + (uint128_t) f1 * g0 + (uint128_t) f2 * g4_19 + (uint128_t) f3 * g3_19 + (uint128_t) f4 * g2_19;
+    r2 = (uint128_t) f0 * g2 + (uint128_t) f1 * g1 + (uint128_t) f2 * g0 + (uint128_t) f3 * g4_19 + (uint128_t) f4 * g3_19;
+    r3 = (uint128_t) f0 * g3 + (uint128_t) f1 * g2 + (uint128_t) f2 * g1 + (uint128_t) f3 * g0 + (uint128_t) f4 * g4_19;
+    r4 = (uint128_t) f0 * g4 + (uint128_t) f1 * g3 + (uint128_t) f2 * g2 + (uint128_t) f3 * g1 + (uint128_t) f4 * g0;
+
+    fe_carry_wide(h, r0, r1, r2, r3, r4);
+}
+
+
+/*
+    h = f * 121666
+    Can overlap h with f.
+*/
+
+void fe_mul121666(fe h, fe f) {
+    fe_carry_wide(h, (uint128_t) f[0] * 121666, (uint128_t) f[1] * 121666, (uint128_t) f[2] * 121666,
+                  (uint128_t) f[3] * 121666, (uint128_t) f[4] * 121666);
+}
+
+
+/*
+    h = -f
+*/
+
+void fe_neg(fe h, const fe f) {
+    fe zero;
+
+    fe_0(zero);
+    fe_sub(h, zero, f);
+}
+
+
+/*
+    r = f * f, left in 128 bit limbs
+*/
+
+static void fe_sq_wide(const fe f, uint128_t r[5]) {
+    uint64_t f0 = f[0], f1 = f[1], f2 = f[2], f3 = f[3], f4 = f[4];
+    uint64_t f0_2 = 2 * f0, f1_2 = 2 * f1;
+    uint64_t f1_38 = 38 * f1, f2_38 = 38 * f2, f3_38 = 38 * f3;
+    uint64_t f3_19 = 19 * f3, f4_19 = 19 * f4;
+
+    r[0] = (uint128_t) f0 * f0 + (uint128_t) f1_38 * f4 + (uint128_t) f2_38 * f3;
+    r[1] = (uint128_t) f0_2 * f1 + (uint128_t) f2_38 * f4 + (uint128_t) f3_19 * f3;
+    r[2] = (uint128_t) f0_2 * f2 + (uint128_t) f1 * f1 + (uint128_t) f3_38 * f4;
+    r[3] = (uint128_t) f0_2 * f3 + (uint128_t) f1_2 * f2 + (uint128_t) f4_19 * f4;
+    r[4] = (uint128_t) f0_2 * f4 + (uint128_t) f1_2 * f3 + (uint128_t) f2 * f2;
+}
+
+
+/*
+    h = f * f
+    Can overlap h with f.
+*/
+
+void fe_sq(fe h, const fe f) {
+    uint128_t r[5];
+
+    fe_sq_wide(f, r);
+    fe_carry_wide(h, r[0], r[1], r[2], r[3], r[4]);
+}
+
+
+/*
+    h = 2 * f * f
+    Can overlap h with f.
+*/
+
+void fe_sq2(fe h, const fe f) {
+    uint128_t r[5];
+
+    fe_sq_wide(f, r);
+    fe_carry_wide(h, r[0] << 1, r[1] << 1, r[2] << 1, r[3] << 1, r[4] << 1);
+}
+
+
+/*
+    h = f - g
+    Can overlap h with f or g.
+
+    Adds 4p before subtracting so that any g with limbs below 2^53 keeps
+    every limb positive.
+*/
+
+void fe_sub(fe h, const fe f, const fe g) {
+    h[0] = (f[0] + 0x1FFFFFFFFFFFB4ULL) - g[0];
+    h[1] = (f[1] + 0x1FFFFFFFFFFFFCULL) - g[1];
+    h[2] = (f[2] + 0x1FFFFFFFFFFFFCULL) - g[2];
+    h[3] = (f[3] + 0x1FFFFFFFFFFFFCULL) - g[3];
+    h[4] = (f[4] + 0x1FFFFFFFFFFFFCULL) - g[4];
+    fe_carry(h);
+}
+
+
+void fe_invert(fe out, const fe z) {
+    fe t0;
+    fe t1;
+    fe t2;
+    fe t3;
+    int i;
+
+    fe_sq(t0, z);
+
+    for (i = 1; i < 1; ++i) {
+        fe_sq(t0, t0);
+    }
+
+    fe_sq(t1, t0);
+
+    for (i = 1; i < 2; ++i) {
+        fe_sq(t1, t1);
+    }
+
+    fe_mul(t1, z, t1);
+    fe_mul(t0, t0, t1);
+    fe_sq(t2, t0);
+
+    for (i = 1; i < 1; ++i) {
+        fe_sq(t2, t2);
+    }
+
+    fe_mul(t1, t1, t2);
+    fe_sq(t2, t1);
+
+    for (i = 1; i < 5; ++i) {
+        fe_sq(t2, t2);
+    }
+
+    fe_mul(t1, t2, t1);
+    fe_sq(t2, t1);
+
+    for (i = 1; i < 10; ++i) {
+        fe_sq(t2, t2);
+    }
+
+    fe_mul(t2, t2, t1);
+    fe_sq(t3, t2);
+
+    for (i = 1; i < 20; ++i) {
+        fe_sq(t3, t3);
+    }
+
+    fe_mul(t2, t3, t2);
+    fe_sq(t2, t2);
+
+    for (i = 1; i < 10; ++i) {
+        fe_sq(t2, t2);
+    }
+
+    fe_mul(t1, t2, t1);
+    fe_sq(t2, t1);
+
+    for (i = 1; i < 50; ++i) {
+        fe_sq(t2, t2);
+    }
+
+    fe_mul(t2, t2, t1);
+    fe_sq(t3, t2);
+
+    for (i = 1; i < 100; ++i) {
+        fe_sq(t3, t3);
+    }
+
+    fe_mul(t2, t3, t2);
+    fe_sq(t2, t2);
+
+    for (i = 1; i < 50; ++i) {
+        fe_sq(t2, t2);
+    }
+
+    fe_mul(t1, t2, t1);
+    fe_sq(t1, t1);
+
+    for (i = 1; i < 5; ++i) {
+        fe_sq(t1, t1);
+    }
+
+    fe_mul(out, t1, t0);
+}
+
+
+
+void fe_pow22523(fe out, const fe z) {
+    fe t0;
+    fe t1;
+    fe t2;
+    int i;
+    fe_sq(t0, z);
+
+    for (i = 1; i < 1; ++i) {
+        fe_sq(t0, t0);
+    }
+
+    fe_sq(t1, t0);
+
+    for (i = 1; i < 2; ++i) {
+        fe_sq(t1, t1);
+    }
+
+    fe_mul(t1, z, t1);
+    fe_mul(t0, t0, t1);
+    fe_sq(t0, t0);
+
+    for (i = 1; i < 1; ++i) {
+        fe_sq(t0, t0);
+    }
+
+    fe_mul(t0, t1, t0);
+    fe_sq(t1, t0);
+
+    for (i = 1; i < 5; ++i) {
+        fe_sq(t1, t1);
+    }
+
+    fe_mul(t0, t1, t0);
+    fe_sq(t1, t0);
+
+    for (i = 1; i < 10; ++i) {
+        fe_sq(t1, t1);
+    }
+
+    fe_mul(t1, t1, t0);
+    fe_sq(t2, t1);
+
+    for (i = 1; i < 20; ++i) {
+        fe_sq(t2, t2);
+    }
+
+    fe_mul(t1, t2, t1);
+    fe_sq(t1, t1);
+
+    for (i = 1; i < 10; ++i) {
+        fe_sq(t1, t1);
+    }
+
+    fe_mul(t0, t1, t0);
+    fe_sq(t1, t0);
+
+    for (i = 1; i < 50; ++i) {
+        fe_sq(t1, t1);
+    }
+
+    fe_mul(t1, t1, t0);
+    fe_sq(t2, t1);
+
+    for (i = 1; i < 100; ++i) {
+        fe_sq(t2, t2);
+    }
+
+    fe_mul(t1, t2, t1);
+    fe_sq(t1, t1);
+
+    for (i = 1; i < 50; ++i) {
+        fe_sq(t1, t1);
+    }
+
+    fe_mul(t0, t1, t0);
+    fe_sq(t0, t0);
+
+    for (i = 1; i < 2; ++i) {
+        fe_sq(t0, t0);
+    }
+
+    fe_mul(out, t0, z);
+    return;
+}
+
+#endif
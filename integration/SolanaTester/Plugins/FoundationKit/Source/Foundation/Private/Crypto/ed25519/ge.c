@@ -1,5 +1,10 @@
 #include "ge.h"
+
+#if ED25519_FE51
+#include "precomp_data51.h"
+#else
 #include "precomp_data.h"
+#endif
 
 
 /*
@@ -130,6 +135,93 @@ void ge_double_scalarmult_vartime(ge_p2 *r, const unsigned char *a, const ge_p3
 }
 
 
+/*
+r = b * B + a_0 * A_0 + ... + a_(count-1) * A_(count-1)
+where a_j is the 32 byte scalar at a + 32 * j.
+Every scalar gets its own sliding window and table of odd multiples, and all of
+them share one chain of doublings.
+Ai must have room for 8 * count entries and aslide for 256 * count.
+*/
+
+void ge_multi_scalarmult_vartime(ge_p2 *r, const unsigned char *b, const unsigned char *a, const ge_p3 *A, size_t count,
+                                 ge_cached *Ai, signed char *aslide) {
+    signed char bslide[256];
+    ge_p1p1 t;
+    ge_p3 u;
+    ge_p3 A2;
+    size_t j;
+    int k;
+    int i;
+    int top = -1;
+    slide(bslide, b);
+
+    for (j = 0; j < count; ++j) {
+        ge_cached *table = Ai + 8 * j;
+        slide(aslide + 256 * j, a + 32 * j);
+        ge_p3_to_cached(&table[0], &A[j]);
+        ge_p3_dbl(&t, &A[j]);
+        ge_p1p1_to_p3(&A2, &t);
+
+        for (k = 1; k < 8; ++k) {
+            ge_add(&t, &A2, &table[k - 1]);
+            ge_p1p1_to_p3(&u, &t);
+            ge_p3_to_cached(&table[k], &u);
+        }
+
+        for (i = 255; i > top; --i) {
+            if (aslide[256 * j + i]) {
+                top = i;
+                break;
+            }
+        }
+    }
+
+    for (i = 255; i > top; --i) {
+        if (bslide[i]) {
+            top = i;
+            break;
+        }
+    }
+
+    ge_p2_0(r);
+
+    for (i = top; i >= 0; --i) {
+        ge_p2_dbl(&t, r);
+
+        for (j = 0; j < count; ++j) {
+            const signed char s = aslide[256 * j + i];
+
+            if (s > 0) {
+                ge_p1p1_to_p3(&u, &t);
+                ge_add(&t, &u, &Ai[8 * j + s / 2]);
+            } else if (s < 0) {
+                ge_p1p1_to_p3(&u, &t);
+                ge_sub(&t, &u, &Ai[8 * j + (-s) / 2]);
+            }
+        }
+
+        if (bslide[i] > 0) {
+            ge_p1p1_to_p3(&u, &t);
+            ge_madd(&t, &u, &Bi[bslide[i] / 2]);
+        } else if (bslide[i] < 0) {
+            ge_p1p1_to_p3(&u, &t);
+            ge_msub(&t, &u, &Bi[(-bslide[i]) / 2]);
+        }
+
+        ge_p1p1_to_p2(r, &t);
+    }
+}
+
+
+#if ED25519_FE51
+static const fe d = {
+    0x34dca135978a3ULL, 0x1a8283b156ebdULL, 0x5e7a26001c029ULL, 0x739c663a03cbbULL, 0x52036cee2b6ffULL
+};
+
+static const fe sqrtm1 = {
+    0x61b274a0ea0b0ULL, 0xd5a5fc8f189dULL, 0x7ef5e9cbd0c60ULL, 0x78595a6804c9eULL, 0x2b8324804fc1dULL
+};
+#else
 static const fe d = {
     -10913610, 13857413, -15372611, 6949391, 114729, -8787816, -6275908, -3247719, -18696448, -12055116
 };
@@ -137,6 +229,7 @@ static const fe d = {
 static const fe sqrtm1 = {
     -32595792, -7943725, 9377950, 3500415, 12389472, -272473, -25146209, -2005654, 326686, 11406482
 };
+#endif
 
 int ge_frombytes_negate_vartime(ge_p3 *h, const unsigned char *s) {
     fe u;
@@ -295,9 +388,15 @@ void ge_p3_dbl(ge_p1p1 *r, const ge_p3 *p) {
 r = p
 */
 
+#if ED25519_FE51
+static const fe d2 = {
+    0x69b9426b2f159ULL, 0x35050762add7aULL, 0x3cf44c0038052ULL, 0x6738cc7407977ULL, 0x2406d9dc56dffULL
+};
+#else
 static const fe d2 = {
     -21827239, -5839606, -30745221, 13898782, 229458, 15978800, -12551817, -6495438, 29715968, 9444199
 };
+#endif
 
 void ge_p3_to_cached(ge_cached *r, const ge_p3 *p) {
     fe_add(r->YplusX, p->Y, p->X);
@@ -318,6 +417,26 @@ void ge_p3_to_p2(ge_p2 *r, const ge_p3 *p) {
 }
 
 
+/*
+p has small order when 8p is the identity: x = 0 and y = 1
+*/
+
+int ge_is_small_order(const ge_p2 *p) {
+    ge_p1p1 t;
+    ge_p2 r = *p;
+    fe y_minus_z;
+    int i;
+
+    for (i = 0; i < 3; ++i) {
+        ge_p2_dbl(&t, &r);
+        ge_p1p1_to_p2(&r, &t);
+    }
+
+    fe_sub(y_minus_z, r.Y, r.Z);
+    return !fe_isnonzero(r.X) && !fe_isnonzero(y_minus_z);
+}
+
+
 void ge_p3_tobytes(unsigned char *s, const ge_p3 *h) {
     fe recip;
     fe x;
@@ -387,7 +506,9 @@ void ge_scalarmult_base(ge_p3 *h, const unsigned char *a) {
     signed char e[64];
     signed char carry;
     ge_p1p1 r;
+#if !ED25519_FE51
     ge_p2 s;
+#endif
     ge_precomp t;
     int i;
 
@@ -411,6 +532,14 @@ void ge_scalarmult_base(ge_p3 *h, const unsigned char *a) {
     /* each e[i] is between -8 and 8 */
     ge_p3_0(h);
 
+#if ED25519_FE51
+    /* base has a row for every 16^i, no doublings needed */
+    for (i = 0; i < 64; ++i) {
+        select(&t, i, e[i]);
+        ge_madd(&r, h, &t);
+        ge_p1p1_to_p3(h, &r);
+    }
+#else
     for (i = 1; i < 64; i += 2) {
         select(&t, i / 2, e[i]);
         ge_madd(&r, h, &t);
@@ -431,6 +560,7 @@ void ge_scalarmult_base(ge_p3 *h, const unsigned char *a) {
         ge_madd(&r, h, &t);
         ge_p1p1_to_p3(h, &r);
     }
+#endif
 }
 
 
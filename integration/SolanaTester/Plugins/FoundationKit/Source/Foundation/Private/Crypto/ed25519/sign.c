@@ -3,22 +3,26 @@
 #include "ge.h"
 #include "sc.h"
 
-void ed25519_sign(unsigned char *signature, const unsigned char *message, size_t message_len, const unsigned char *private_key) {
+/*
+expanded = clamped secret scalar (32 bytes) || nonce prefix (32 bytes)
+*/
+
+void ed25519_expand_private_key(unsigned char *expanded, const unsigned char *private_key) {
+    ed_sha512(private_key, 32, expanded);
+    expanded[0] &= 248;
+    expanded[31] &= 127;
+    expanded[31] |= 64;
+}
+
+void ed25519_sign_expanded(unsigned char *signature, const unsigned char *message, size_t message_len,
+                           const unsigned char *public_key, const unsigned char *expanded) {
     sha512_context hash;
-    unsigned char az[64];
     unsigned char hram[64];
     unsigned char r[64];
     ge_p3 R;
 
     ed_sha512_init(&hash);
-    ed_sha512_update(&hash, private_key, 32);
-    ed_sha512_final(&hash, az);
-    az[0] &= 248;
-    az[31] &= 127;
-    az[31] |= 64;
-    
-    ed_sha512_init(&hash);
-    ed_sha512_update(&hash, az + 32, 32);
+    ed_sha512_update(&hash, expanded + 32, 32);
     ed_sha512_update(&hash, message, message_len);
     ed_sha512_final(&hash, r);
 
@@ -28,10 +32,17 @@ void ed25519_sign(unsigned char *signature, const unsigned char *message, size_t
     
     ed_sha512_init(&hash);
     ed_sha512_update(&hash, signature, 32);
-    ed_sha512_update(&hash, private_key + 32, 32);
+    ed_sha512_update(&hash, public_key, 32);
     ed_sha512_update(&hash, message, message_len);
     ed_sha512_final(&hash, hram);
 
     sc_reduce(hram);
-    sc_muladd(signature + 32, hram, az, r);
+    sc_muladd(signature + 32, hram, expanded, r);
+}
+
+void ed25519_sign(unsigned char *signature, const unsigned char *message, size_t message_len, const unsigned char *private_key) {
+    unsigned char az[64];
+
+    ed25519_expand_private_key(az, private_key);
+    ed25519_sign_expanded(signature, message, message_len, private_key + 32, az);
 }
@@ -75,3 +75,37 @@ int ed25519_verify(const unsigned char *signature, const unsigned char *message,
 
     return 1;
 }
+
+/*
+The rules Solana validators apply to transaction signatures: the cofactorless
+equation of ed25519_verify, plus a reduced s and neither A nor R of small order.
+*/
+
+int ed25519_verify_strict(const unsigned char *signature, const unsigned char *message, size_t message_len, const unsigned char *public_key) {
+    ge_p3 point;
+    ge_p2 projected;
+
+    if (!sc_is_canonical(signature + 32)) {
+        return 0;
+    }
+
+    if (ge_frombytes_negate_vartime(&point, public_key) != 0) {
+        return 0;
+    }
+
+    ge_p3_to_p2(&projected, &point);
+    if (ge_is_small_order(&projected)) {
+        return 0;
+    }
+
+    if (ge_frombytes_negate_vartime(&point, signature) != 0) {
+        return 0;
+    }
+
+    ge_p3_to_p2(&projected, &point);
+    if (ge_is_small_order(&projected)) {
+        return 0;
+    }
+
+    return ed25519_verify(signature, message, message_len, public_key);
+}
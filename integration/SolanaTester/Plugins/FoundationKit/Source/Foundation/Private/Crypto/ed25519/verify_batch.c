@@ -0,0 +1,187 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include "ed25519.h"
+#include "ed_sha512.h"
+#include "ge.h"
+#include "sc.h"
+
+/*
+Batch verification checks the random linear combination
+
+    8 * ((sum z_i s_i) B - sum z_i R_i - sum (z_i h_i) A_i) = 0
+
+for 128 bit random z_i, with one multi-scalar multiplication per BATCH_CHUNK
+signatures. If the combination does not vanish, every signature of the chunk
+is checked on its own to find the bad ones.
+
+The combined check is the cofactored equation allowed by RFC 8032. Signatures
+checked on their own, alone in their chunk or to find the bad ones, go through
+ed25519_verify_cofactored, the same equation, so a signature gets the same
+verdict whatever the rest of its batch. ed25519_verify and
+ed25519_verify_strict are cofactorless and can reject a signature whose R or A
+carries a small order component that passes here. Honestly generated
+signatures verify the same way everywhere.
+*/
+
+#define BATCH_CHUNK 32
+
+typedef struct {
+    ge_p3 points[2 * BATCH_CHUNK];                  /* -R_i, -A_i */
+    unsigned char scalars[2 * BATCH_CHUNK * 32];    /* z_i, z_i h_i */
+    ge_cached tables[8 * 2 * BATCH_CHUNK];
+    signed char slides[256 * 2 * BATCH_CHUNK];
+    size_t indices[BATCH_CHUNK];
+} batch_scratch;
+
+/*
+ed25519_verify re-encodes R and compares bytes, so R must be the canonical
+encoding: y < p, and no sign bit on x = 0 (y = 1 or y = -1).
+*/
+
+static int is_canonical_point(const unsigned char *s) {
+    int i;
+    int ones = (s[31] & 0x7f) == 0x7f;
+    int zeros = (s[31] & 0x7f) == 0;
+
+    for (i = 30; i > 0; --i) {
+        ones &= s[i] == 0xff;
+        zeros &= s[i] == 0;
+    }
+
+    if (ones && s[0] >= 0xed) {
+        return 0;
+    }
+
+    if ((s[31] & 0x80) && ((zeros && s[0] == 1) || (ones && s[0] == 0xec))) {
+        return 0;
+    }
+
+    return 1;
+}
+
+/*
+Decodes -R and -A and computes h = H(R || A || M) mod l, or returns 0 if the
+signature cannot be valid. s must be below l as RFC 8032 requires, otherwise
+s + l would verify as well and signatures would be malleable.
+*/
+
+static int load_signature(ge_p3 *points, unsigned char *h, const unsigned char *signature, const unsigned char *message,
+                          size_t message_len, const unsigned char *public_key) {
+    sha512_context hash;
+
+    if (!sc_is_canonical(signature + 32) || !is_canonical_point(signature)
+        || ge_frombytes_negate_vartime(&points[0], signature) != 0
+        || ge_frombytes_negate_vartime(&points[1], public_key) != 0) {
+        return 0;
+    }
+
+    ed_sha512_init(&hash);
+    ed_sha512_update(&hash, signature, 32);
+    ed_sha512_update(&hash, public_key, 32);
+    ed_sha512_update(&hash, message, message_len);
+    ed_sha512_final(&hash, h);
+    sc_reduce(h);
+    return 1;
+}
+
+/*
+8 * (s B - R - h A) = 0 for one signature.
+*/
+
+int ed25519_verify_cofactored(const unsigned char *signature, const unsigned char *message, size_t message_len,
+                              const unsigned char *public_key) {
+    unsigned char scalars[64] = { 1 };
+    ge_p3 points[2];
+    ge_cached tables[8 * 2];
+    signed char slides[256 * 2];
+    ge_p2 r;
+
+    if (!load_signature(points, scalars + 32, signature, message, message_len, public_key)) {
+        return 0;
+    }
+
+    ge_multi_scalarmult_vartime(&r, signature + 32, scalars, points, 2, tables, slides);
+    return ge_is_small_order(&r);
+}
+
+int ed25519_verify_batch(const unsigned char *const *signatures, const unsigned char *const *messages,
+                         const size_t *message_lens, const unsigned char *const *public_keys, size_t count,
+                         const unsigned char *random, int *valid) {
+    static const unsigned char zero[32] = { 0 };
+    batch_scratch *scratch;
+    unsigned char h[64];
+    unsigned char z[32];
+    unsigned char b[32];
+    ge_p2 r;
+    size_t start;
+    size_t i;
+    size_t j;
+    size_t n;
+    int all_valid = 1;
+
+    scratch = (batch_scratch *) malloc(sizeof(batch_scratch));
+
+    if (scratch == NULL) {
+        for (i = 0; i < count; ++i) {
+            valid[i] = ed25519_verify_cofactored(signatures[i], messages[i], message_lens[i], public_keys[i]);
+            all_valid &= valid[i];
+        }
+
+        return all_valid;
+    }
+
+    for (start = 0; start < count; start = i) {
+        memset(b, 0, 32);
+        n = 0;
+
+        for (i = start; i < count && n < BATCH_CHUNK; ++i) {
+            const unsigned char *signature = signatures[i];
+            valid[i] = 0;
+
+            if (!load_signature(&scratch->points[2 * n], h, signature, messages[i], message_lens[i], public_keys[i])) {
+                all_valid = 0;
+                continue;
+            }
+
+            /* z_i must not be zero or the signature would drop out of the sum. */
+            memcpy(z, random + 16 * i, 16);
+            memset(z + 16, 0, 16);
+            z[0] |= 1;
+
+            memcpy(scratch->scalars + 64 * n, z, 32);
+            sc_muladd(scratch->scalars + 64 * n + 32, z, h, zero);
+            sc_muladd(b, z, signature + 32, b);
+            scratch->indices[n++] = i;
+        }
+
+        if (n == 0) {
+            continue;
+        }
+
+        /* A lone signature is cheaper to check directly. */
+        if (n == 1) {
+            const size_t k = scratch->indices[0];
+            valid[k] = ed25519_verify_cofactored(signatures[k], messages[k], message_lens[k], public_keys[k]);
+            all_valid &= valid[k];
+            continue;
+        }
+
+        ge_multi_scalarmult_vartime(&r, b, scratch->scalars, scratch->points, 2 * n, scratch->tables, scratch->slides);
+
+        if (ge_is_small_order(&r)) {
+            for (j = 0; j < n; ++j) {
+                valid[scratch->indices[j]] = 1;
+            }
+        } else {
+            for (j = 0; j < n; ++j) {
+                const size_t k = scratch->indices[j];
+                valid[k] = ed25519_verify_cofactored(signatures[k], messages[k], message_lens[k], public_keys[k]);
+                all_valid &= valid[k];
+            }
+        }
+    }
+
+    free(scratch);
+    return all_valid;
+}
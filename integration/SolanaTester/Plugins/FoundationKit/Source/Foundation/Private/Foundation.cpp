@@ -17,16 +17,25 @@ limitations under the License.
 
 #include "Foundation.h"
 
+#include "FoundationSettings.h"
+#include "Network/BlockhashCache.h"
+#include "Network/RequestManager.h"
+
 #define LOCTEXT_NAMESPACE "FFoundationModule"
 
 void FFoundationModule::StartupModule()
 {
-
+	// Editor and PIE sessions start the module on every load, only packaged games warm up.
+	if (!GIsEditor && !IsRunningCommandlet() && GetDefault<UFoundationSettings>()->ShouldWarmUpConnection())
+	{
+		FRequestManager::WarmUp();
+		FBlockhashCache::Get().Start();
+	}
 }
 
 void FFoundationModule::ShutdownModule()
 {
-
+	FBlockhashCache::Get().Stop();
 }
 
 #undef LOCTEXT_NAMESPACE
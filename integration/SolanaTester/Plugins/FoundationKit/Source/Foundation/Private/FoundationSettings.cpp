@@ -33,3 +33,22 @@ FString UFoundationSettings::GetNetworkURL() const
 	}
 	return NetworkURL;
 }
+
+int32 UFoundationSettings::GetMaxRequestBatchSize() const
+{
+	if (const int32* MaxBatchSize = MaxRequestBatchSizes.Find(GetNetwork()))
+	{
+		return *MaxBatchSize;
+	}
+	return DefaultMaxRequestBatchSize;
+}
+
+int32 UFoundationSettings::GetMaxRequestsInFlight() const
+{
+	// Config files bypass the editor clamp.
+	if (const int32* MaxInFlight = MaxRequestsInFlight.Find(GetNetwork()))
+	{
+		return FMath::Max(1, *MaxInFlight);
+	}
+	return FMath::Max(1, DefaultMaxRequestsInFlight);
+}
@@ -0,0 +1,290 @@
+/*
+Copyright 2022 ATMTA, Inc.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+	http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+#include "Network/BlockhashCache.h"
+
+#include "Dom/JsonObject.h"
+#include "Misc/Base64.h"
+#include "Network/RequestManager.h"
+#include "Network/RequestUtils.h"
+#include "SolanaUtils/Utils/ByteCursor.h"
+#include "SolanaUtils/Utils/Types.h"
+
+// Version, state, authority, nonce and the fee calculator of the blockhash the nonce was taken from.
+constexpr int32  NonceAccountSize = 80;
+constexpr uint32 NonceStateInitialized = 1;
+
+double FBlockhashInfo::GetRemainingLifetime() const
+{
+	if (Blockhash.IsEmpty()) { return 0.0; }
+
+	const double BlocksLeft = BlockHeight > 0
+		? static_cast<double>(LastValidBlockHeight) - static_cast<double>(BlockHeight)
+		: FBlockhashCache::MaxProcessingAge;
+	return ReceivedTime + BlocksLeft * FBlockhashCache::SlotDuration - FPlatformTime::Seconds();
+}
+
+bool FDurableNonce::Deserialize(const FPublicKey& InNonceAccount, const TArray<uint8>& Data, FDurableNonce& OutNonce)
+{
+	FByteReader   Reader(Data);
+	uint32        Version = 0;
+	uint32        State = 0;
+	FDurableNonce Nonce;
+	FPublicKey    NonceHash;
+	if (Data.Num() != NonceAccountSize || !Reader.ReadU32LE(Version) || !Reader.ReadU32LE(State) || State != NonceStateInitialized
+		|| !Reader.ReadKey(Nonce.Authority) || !Reader.ReadKey(NonceHash) || !Reader.ReadU64LE(Nonce.LamportsPerSignature))
+	{
+		UE_LOG(LogTemp, Error, TEXT("%s is not an initialized nonce account"), *InNonceAccount.ToBase58());
+		return false;
+	}
+
+	Nonce.NonceAccount = InNonceAccount;
+	Nonce.Nonce = NonceHash.ToBase58();
+	OutNonce = MoveTemp(Nonce);
+	return true;
+}
+
+FBlockhashCache& FBlockhashCache::Get()
+{
+	static FBlockhashCache Instance;
+	return Instance;
+}
+
+void FBlockhashCache::Start(float RefreshInterval)
+{
+	Stop();
+	{
+		FScopeLock ScopeLock(&Lock);
+		bStarted = true;
+	}
+	TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda([this](float DeltaTime)
+	{
+		Refresh();
+		return true;
+	}), RefreshInterval);
+	Refresh();
+}
+
+void FBlockhashCache::Stop()
+{
+	if (TickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+		TickerHandle.Reset();
+	}
+}
+
+bool FBlockhashCache::IsRunning() const
+{
+	return TickerHandle.IsValid();
+}
+
+void FBlockhashCache::SetMinRemainingLifetime(double Seconds)
+{
+	FScopeLock ScopeLock(&Lock);
+	MinRemainingLifetime = Seconds;
+}
+
+bool FBlockhashCache::GetBlockhash(FBlockhashInfo& OutInfo)
+{
+	bool bUsable;
+	bool bRefresh;
+	bool bStart;
+	{
+		FScopeLock ScopeLock(&Lock);
+		bStart = !bStarted;
+		bStarted = true;
+
+		const double Remaining = Latest.GetRemainingLifetime();
+		bUsable = Remaining >= MinRemainingLifetime;
+		bRefresh = Remaining < 2.0 * MinRemainingLifetime;
+		if (bUsable) { OutInfo = Latest; }
+	}
+
+	// Refresh before the hash becomes unusable rather than after, so callers never see a cold cache while it runs.
+	if (bStart) { Start(); }
+	else if (bRefresh) { Refresh(); }
+	return bUsable;
+}
+
+bool FBlockhashCache::GetBlockhash(FString& OutBlockhash)
+{
+	FBlockhashInfo Info;
+	if (!GetBlockhash(Info)) { return false; }
+
+	OutBlockhash = MoveTemp(Info.Blockhash);
+	return true;
+}
+
+void FBlockhashCache::GetBlockhashAsync(TFunction<void(const FBlockhashInfo*)> OnReady)
+{
+	FBlockhashInfo Info;
+	if (GetBlockhash(Info))
+	{
+		OnReady(&Info);
+		return;
+	}
+
+	// Checked again under the lock, a refresh may have completed in between.
+	{
+		FScopeLock ScopeLock(&Lock);
+		if (Latest.GetRemainingLifetime() < MinRemainingLifetime)
+		{
+			Waiters.Add(MoveTemp(OnReady));
+			OnReady = nullptr;
+		}
+		else { Info = Latest; }
+	}
+
+	if (OnReady) { OnReady(&Info); }
+	else { Refresh(); }
+}
+
+void FBlockhashCache::Refresh()
+{
+	{
+		FScopeLock ScopeLock(&Lock);
+		if (bRefreshInFlight) { return; }
+		bRefreshInFlight = true;
+	}
+
+	// Both go out together, the lifetime of the hash is the distance between its last valid height and the current one.
+	const TSharedPtr<FRefresh> State = MakeShared<FRefresh>();
+
+	const auto HashRequest = FRequestUtils::RequestBlockHash();
+	HashRequest->Priority = ERequestPriority::Background;
+	HashRequest->Callback.BindLambda([this, State](FJsonObject& Data)
+	{
+		FBlockhashInfo& Info = State->Info;
+		if (FRequestUtils::ParseLatestBlockHashResponse(Data, Info.Blockhash, Info.LastValidBlockHeight))
+		{
+			Info.ReceivedTime = FPlatformTime::Seconds();
+		}
+		else
+		{
+			UE_LOG(LogTemp, Error, TEXT("Unexpected getLatestBlockhash response"));
+			Info = FBlockhashInfo();
+		}
+		OnRefreshPart(State);
+	});
+	HashRequest->ErrorCallback.BindLambda([this, State](FString& Error) { OnRefreshPart(State); });
+
+	const auto HeightRequest = FRequestUtils::RequestBlockHeight();
+	HeightRequest->Priority = ERequestPriority::Background;
+	HeightRequest->Callback.BindLambda([this, State](FJsonObject& Data)
+	{
+		if (FRequestUtils::ParseBlockHeightResponse(Data, State->BlockHeight)) { State->BlockHeightTime = FPlatformTime::Seconds(); }
+		else { UE_LOG(LogTemp, Error, TEXT("Unexpected getBlockHeight response")); }
+		OnRefreshPart(State);
+	});
+	HeightRequest->ErrorCallback.BindLambda([this, State](FString& Error) { OnRefreshPart(State); });
+
+	FRequestManager::SendRequest(HashRequest);
+	FRequestManager::SendRequest(HeightRequest);
+}
+
+void FBlockhashCache::OnRefreshPart(const TSharedPtr<FRefresh>& State)
+{
+	{
+		FScopeLock ScopeLock(&Lock);
+		if (--State->Pending > 0) { return; }
+	}
+	OnRefreshed(*State);
+}
+
+void FBlockhashCache::OnRefreshed(const FRefresh& Result)
+{
+	TArray<TFunction<void(const FBlockhashInfo*)>> Ready;
+	FBlockhashInfo                                 Served;
+	bool                                           bUsable;
+	{
+		FScopeLock ScopeLock(&Lock);
+		bRefreshInFlight = false;
+
+		const FBlockhashInfo& Info = Result.Info;
+		if (!Info.Blockhash.IsEmpty() && Info.LastValidBlockHeight >= Latest.LastValidBlockHeight) { Latest = Info; }
+
+		if (Result.BlockHeight > 0)
+		{
+			// The cluster is the authority on expiry, a hash it has moved past is dropped whatever the estimate says.
+			if (!Latest.IsValidAt(Result.BlockHeight)) { Latest = FBlockhashInfo(); }
+			else if (Result.BlockHeight > Latest.BlockHeight)
+			{
+				Latest.BlockHeight = Result.BlockHeight;
+				Latest.ReceivedTime = Result.BlockHeightTime;
+			}
+		}
+
+		bUsable = Latest.GetRemainingLifetime() >= MinRemainingLifetime;
+		Served = Latest;
+		Ready = MoveTemp(Waiters);
+	}
+
+	for (const TFunction<void(const FBlockhashInfo*)>& OnReady : Ready) { OnReady(bUsable ? &Served : nullptr); }
+}
+
+void FBlockhashCache::FetchNonce(const FPublicKey& NonceAccount, TFunction<void(const FDurableNonce*)> OnLoaded)
+{
+	FDurableNonce Cached;
+	{
+		FScopeLock ScopeLock(&Lock);
+		if (const FDurableNonce* Nonce = Nonces.Find(NonceAccount)) { Cached = *Nonce; }
+	}
+
+	if (!Cached.Nonce.IsEmpty())
+	{
+		OnLoaded(&Cached);
+		return;
+	}
+
+	const auto Request = FRequestUtils::RequestAccountInfo(NonceAccount.ToBase58(), ERequestEncoding::Base64);
+	Request->Callback.BindLambda([this, NonceAccount, OnLoaded](FJsonObject& Data)
+	{
+		const TSharedPtr<FJsonObject>*        Result;
+		const TSharedPtr<FJsonObject>*        Value;
+		const TArray<TSharedPtr<FJsonValue>>* AccountData;
+
+		TArray<uint8> Bytes;
+		if (!Data.TryGetObjectField(TEXT("result"), Result) || !(*Result)->TryGetObjectField(TEXT("value"), Value)
+			|| !(*Value)->TryGetArrayField(TEXT("data"), AccountData) || AccountData->IsEmpty()
+			|| !FBase64::Decode((*AccountData)[0]->AsString(), Bytes))
+		{
+			UE_LOG(LogTemp, Error, TEXT("Nonce account %s not found"), *NonceAccount.ToBase58());
+			OnLoaded(nullptr);
+			return;
+		}
+
+		FDurableNonce Nonce;
+		if (!FDurableNonce::Deserialize(NonceAccount, Bytes, Nonce))
+		{
+			OnLoaded(nullptr);
+			return;
+		}
+
+		{
+			FScopeLock ScopeLock(&Lock);
+			Nonces.Add(NonceAccount, Nonce);
+		}
+		OnLoaded(&Nonce);
+	});
+	Request->ErrorCallback.BindLambda([OnLoaded](FString& Error) { OnLoaded(nullptr); });
+	FRequestManager::SendRequest(Request);
+}
+
+void FBlockhashCache::InvalidateNonce(const FPublicKey& NonceAccount)
+{
+	FScopeLock ScopeLock(&Lock);
+	Nonces.Remove(NonceAccount);
+}
@@ -0,0 +1,355 @@
+/*
+Copyright 2022 ATMTA, Inc.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+	http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+#include "Network/ProgramAccountsParser.h"
+
+#include "Crypto/Base58.h"
+#include "Misc/Base64.h"
+
+// Longer keys are never the ones looked for.
+constexpr int32 MaxKeyLength = 16;
+
+namespace
+{
+	bool Equals(TConstArrayView<uint8> Bytes, const ANSICHAR* Literal)
+	{
+		const int32 Len = FCStringAnsi::Strlen(Literal);
+		return Bytes.Num() == Len && FMemory::Memcmp(Bytes.GetData(), Literal, Len) == 0;
+	}
+
+	bool IsWhitespace(uint8 C)
+	{
+		return C == ' ' || C == '\t' || C == '\n' || C == '\r';
+	}
+
+	// Reads one complete JSON value in place.
+	struct FCursor
+	{
+		const uint8* Pos;
+		const uint8* End;
+
+		explicit FCursor(TConstArrayView<uint8> Bytes)
+			: Pos(Bytes.GetData())
+			, End(Bytes.GetData() + Bytes.Num())
+		{
+		}
+
+		bool Consume(uint8 C)
+		{
+			while (Pos < End && IsWhitespace(*Pos)) { Pos++; }
+			if (Pos == End || *Pos != C) { return false; }
+			Pos++;
+			return true;
+		}
+
+		// The raw characters of a string, escapes left as they are.
+		bool ReadString(TConstArrayView<uint8>& OutView, bool& bOutEscaped)
+		{
+			if (!Consume('"')) { return false; }
+
+			const uint8* Start = Pos;
+			bOutEscaped = false;
+			for (; Pos < End && *Pos != '"'; Pos++)
+			{
+				if (*Pos == '\\')
+				{
+					bOutEscaped = true;
+					Pos++;
+				}
+			}
+			if (Pos >= End) { return false; }
+
+			OutView = TConstArrayView<uint8>(Start, Pos - Start);
+			Pos++;
+			return true;
+		}
+
+		bool ReadString(TConstArrayView<uint8>& OutView)
+		{
+			bool bHasEscapes;
+			return ReadString(OutView, bHasEscapes) && !bHasEscapes;
+		}
+
+		bool ReadKey(FPublicKey& OutKey)
+		{
+			TConstArrayView<uint8> View;
+			if (!ReadString(View) || View.Num() > FBase58::MaxEncoded32Size) { return false; }
+
+			TCHAR Chars[FBase58::MaxEncoded32Size];
+			for (int32 i = 0; i < View.Num(); i++) { Chars[i] = View[i]; }
+
+			uint8 Bytes[FPublicKey::Size];
+			if (!FBase58::Decode32(Chars, View.Num(), Bytes)) { return false; }
+			OutKey = FPublicKey(Bytes);
+			return true;
+		}
+
+		// Saturates rather than overflowing, u64 max is the only value close to it in practice.
+		bool ReadUInt64(uint64& OutValue)
+		{
+			while (Pos < End && IsWhitespace(*Pos)) { Pos++; }
+
+			const uint8* Start = Pos;
+			uint64 Value = 0;
+			for (; Pos < End && *Pos >= '0' && *Pos <= '9'; Pos++)
+			{
+				const uint64 Digit = *Pos - '0';
+				Value = Value > (MAX_uint64 - Digit) / 10 ? MAX_uint64 : Value * 10 + Digit;
+			}
+			OutValue = Value;
+			return Pos > Start;
+		}
+
+		bool ReadBool(bool& OutValue)
+		{
+			while (Pos < End && IsWhitespace(*Pos)) { Pos++; }
+			if (End - Pos >= 4 && FMemory::Memcmp(Pos, "true", 4) == 0)
+			{
+				Pos += 4;
+				OutValue = true;
+				return true;
+			}
+			if (End - Pos >= 5 && FMemory::Memcmp(Pos, "false", 5) == 0)
+			{
+				Pos += 5;
+				OutValue = false;
+				return true;
+			}
+			return false;
+		}
+
+		bool SkipValue()
+		{
+			while (Pos < End && IsWhitespace(*Pos)) { Pos++; }
+			if (Pos == End) { return false; }
+
+			if (*Pos == '"')
+			{
+				TConstArrayView<uint8> View;
+				bool bHasEscapes;
+				return ReadString(View, bHasEscapes);
+			}
+
+			int32 Nesting = 0;
+			for (; Pos < End; Pos++)
+			{
+				const uint8 C = *Pos;
+				if (C == '"')
+				{
+					TConstArrayView<uint8> View;
+					bool bHasEscapes;
+					if (!ReadString(View, bHasEscapes)) { return false; }
+					Pos--;
+				}
+				else if (C == '{' || C == '[') { Nesting++; }
+				else if (C == '}' || C == ']')
+				{
+					if (Nesting == 0) { return true; }
+					if (--Nesting == 0)
+					{
+						Pos++;
+						return true;
+					}
+				}
+				else if (Nesting == 0 && (C == ',' || IsWhitespace(C))) { return true; }
+			}
+			return Nesting == 0;
+		}
+
+		// Calls OnField for every key of an object, which must read its value.
+		template <typename FieldFunc>
+		bool ReadObject(FieldFunc&& OnField)
+		{
+			if (!Consume('{')) { return false; }
+			if (Consume('}')) { return true; }
+			do
+			{
+				TConstArrayView<uint8> Name;
+				if (!ReadString(Name) || !Consume(':') || !OnField(Name)) { return false; }
+			}
+			while (Consume(','));
+			return Consume('}');
+		}
+	};
+} // namespace
+
+FProgramAccountsParser::FProgramAccountsParser(FSink InSink)
+	: Sink(MoveTemp(InSink))
+{
+}
+
+bool FProgramAccountsParser::Feed(TConstArrayView<uint8> Chunk)
+{
+	for (const uint8 C : Chunk)
+	{
+		if (State == EState::Done || State == EState::Failed) { break; }
+
+		if (State == EState::Entry || State == EState::ErrorObject)
+		{
+			Buffer.Add(C);
+			if (bInString)
+			{
+				if (bEscaped) { bEscaped = false; }
+				else if (C == '\\') { bEscaped = true; }
+				else if (C == '"') { bInString = false; }
+			}
+			else if (C == '"') { bInString = true; }
+			else if (C == '{' || C == '[') { BufferDepth++; }
+			else if ((C == '}' || C == ']') && --BufferDepth == 0)
+			{
+				if (State == EState::ErrorObject)
+				{
+					ParseErrorObject();
+					return false;
+				}
+				if (!ParseEntry()) { return false; }
+				Buffer.Reset();
+				State = EState::Result;
+			}
+			continue;
+		}
+
+		if (bInString)
+		{
+			if (bEscaped) { bEscaped = false; }
+			else if (C == '\\') { bEscaped = true; }
+			else if (C == '"') { bInString = false; }
+			else if (Depth == 1 && Key.Num() <= MaxKeyLength) { Key.Add(C); }
+			continue;
+		}
+
+		switch (C)
+		{
+		case '"':
+			bInString = true;
+			if (Depth == 1) { Key.Reset(); }
+			break;
+		case '{':
+			if (State == EState::Result && Depth == 2)
+			{
+				State = EState::Entry;
+				Buffer.Add(C);
+				BufferDepth = 1;
+			}
+			else if (Depth == 1 && Equals(Key, "error"))
+			{
+				State = EState::ErrorObject;
+				Buffer.Add(C);
+				BufferDepth = 1;
+			}
+			else { Depth++; }
+			break;
+		case '[':
+			if (Depth == 1 && Equals(Key, "result")) { State = EState::Result; }
+			Depth++;
+			break;
+		case '}':
+		case ']':
+			if (--Depth < 0) { return Fail(TEXT("unbalanced brackets")); }
+			if (State == EState::Result && Depth == 1) { State = EState::Done; }
+			break;
+		default:
+			break;
+		}
+	}
+
+	return State != EState::Failed;
+}
+
+bool FProgramAccountsParser::Finish()
+{
+	if (State == EState::Failed) { return false; }
+	if (State != EState::Done) { return Fail(TEXT("the response ended before its result array")); }
+	return true;
+}
+
+bool FProgramAccountsParser::Fail(const FString& Reason)
+{
+	UE_LOG(LogTemp, Error, TEXT("Failed to parse getProgramAccounts response: %s"), *Reason);
+	Error = Reason;
+	State = EState::Failed;
+	return false;
+}
+
+bool FProgramAccountsParser::ParseEntry()
+{
+	FProgramAccountView Account;
+	bool bHasData = false;
+
+	FCursor Cursor(Buffer);
+	const bool bParsed = Cursor.ReadObject([&](TConstArrayView<uint8> Name)
+	{
+		if (Equals(Name, "pubkey")) { return Cursor.ReadKey(Account.Pubkey); }
+		if (!Equals(Name, "account")) { return Cursor.SkipValue(); }
+
+		return Cursor.ReadObject([&](TConstArrayView<uint8> Field)
+		{
+			if (Equals(Field, "owner")) { return Cursor.ReadKey(Account.Owner); }
+			if (Equals(Field, "lamports")) { return Cursor.ReadUInt64(Account.Lamports); }
+			if (Equals(Field, "rentEpoch")) { return Cursor.ReadUInt64(Account.RentEpoch); }
+			if (Equals(Field, "executable")) { return Cursor.ReadBool(Account.bExecutable); }
+			if (!Equals(Field, "data")) { return Cursor.SkipValue(); }
+
+			TConstArrayView<uint8> Encoded;
+			TConstArrayView<uint8> Encoding;
+			if (!Cursor.Consume('[') || !Cursor.ReadString(Encoded) || !Cursor.Consume(',') || !Cursor.ReadString(Encoding)
+				|| !Cursor.Consume(']') || !Equals(Encoding, "base64"))
+			{
+				return false;
+			}
+
+			const ANSICHAR* Chars = reinterpret_cast<const ANSICHAR*>(Encoded.GetData());
+			Data.Reset();
+			if (Encoded.Num() > 0)
+			{
+				Data.AddUninitialized(FBase64::GetDecodedDataSize(Chars, Encoded.Num()));
+				if (!FBase64::Decode(Chars, Encoded.Num(), Data.GetData())) { return false; }
+			}
+			bHasData = true;
+			return true;
+		});
+	});
+
+	if (!bParsed || !bHasData)
+	{
+		return Fail(FString::Printf(TEXT("account %d is malformed or not base64 encoded"), AccountCount));
+	}
+
+	Account.Data = Data;
+	AccountCount++;
+	Sink(Account);
+	return true;
+}
+
+void FProgramAccountsParser::ParseErrorObject()
+{
+	FString Message = TEXT("error response");
+
+	FCursor Cursor(Buffer);
+	Cursor.ReadObject([&](TConstArrayView<uint8> Name)
+	{
+		if (!Equals(Name, "message")) { return Cursor.SkipValue(); }
+
+		TConstArrayView<uint8> View;
+		bool bHasEscapes;
+		if (!Cursor.ReadString(View, bHasEscapes)) { return false; }
+
+		const FUTF8ToTCHAR Converter(reinterpret_cast<const ANSICHAR*>(View.GetData()), View.Num());
+		Message = FString(Converter.Length(), Converter.Get());
+		return true;
+	});
+
+	Fail(Message);
+}
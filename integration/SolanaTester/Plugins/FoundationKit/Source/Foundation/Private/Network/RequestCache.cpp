@@ -0,0 +1,543 @@
+/*
+Copyright 2022 ATMTA, Inc.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+	http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+#include "Network/RequestCache.h"
+
+#include "Async/Async.h"
+#include "Containers/Ticker.h"
+#include "Crypto/Base58.h"
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
+#include "FoundationSettings.h"
+#include "Misc/Base64.h"
+#include "Network/RequestManager.h"
+#include "Network/RequestUtils.h"
+#include "SolanaUtils/Utils/ByteCursor.h"
+
+namespace
+{
+	// The commitment of requests that do not set one.
+	const TCHAR* DefaultCommitment = TEXT("finalized");
+
+	// A watched transaction that is still unknown by then never landed, its blockhash expired long before.
+	constexpr double ConfirmationTimeout = 90.0;
+	constexpr float  ConfirmationPollInterval = 0.4f;
+	// The most signatures getSignatureStatuses takes at once.
+	constexpr int32  MaxSignaturesPerPoll = 256;
+
+	// Sharing a request would send its effect once for several callers.
+	bool IsShareable(const FString& Method)
+	{
+		return !Method.IsEmpty() && Method != TEXT("sendTransaction") && Method != TEXT("requestAirdrop");
+	}
+
+	// Reads a string field of a request body, whitespace around the colon allowed. Returns an empty string if missing.
+	FString ReadStringField(const FString& Body, const TCHAR* Field)
+	{
+		const FString Name = FString::Printf(TEXT("\"%s\""), Field);
+		const int32 NameStart = Body.Find(Name, ESearchCase::CaseSensitive);
+		if (NameStart == INDEX_NONE) { return FString(); }
+
+		int32 Index = NameStart + Name.Len();
+		while (Index < Body.Len() && (FChar::IsWhitespace(Body[Index]) || Body[Index] == TEXT(':'))) { Index++; }
+		if (Index >= Body.Len() || Body[Index] != TEXT('"')) { return FString(); }
+
+		const int32 ValueStart = Index + 1;
+		const int32 ValueEnd = Body.Find(TEXT("\""), ESearchCase::CaseSensitive, ESearchDir::FromStart, ValueStart);
+		return ValueEnd == INDEX_NONE ? FString() : Body.Mid(ValueStart, ValueEnd - ValueStart);
+	}
+
+	// The string values in the params of a request body, object keys left out: the accounts it reads among them.
+	TArray<FString> ReadParamStrings(const FString& Body)
+	{
+		TArray<FString> Strings;
+		const FString   Name = TEXT("\"params\"");
+		int32           Index = Body.Find(Name, ESearchCase::CaseSensitive);
+		if (Index == INDEX_NONE) { return Strings; }
+
+		Index += Name.Len();
+		while (Index < Body.Len() && (FChar::IsWhitespace(Body[Index]) || Body[Index] == TEXT(':'))) { Index++; }
+
+		for (int32 Depth = 0; Index < Body.Len(); Index++)
+		{
+			const TCHAR Char = Body[Index];
+			if (Char == TEXT('[') || Char == TEXT('{')) { Depth++; }
+			else if (Char == TEXT(']') || Char == TEXT('}'))
+			{
+				if (--Depth <= 0) { break; }
+			}
+			else if (Char == TEXT('"'))
+			{
+				const int32 Start = Index + 1;
+				for (Index = Start; Index < Body.Len() && Body[Index] != TEXT('"'); Index++)
+				{
+					if (Body[Index] == TEXT('\\')) { Index++; }
+				}
+
+				int32 Next = Index + 1;
+				while (Next < Body.Len() && FChar::IsWhitespace(Body[Next])) { Next++; }
+				if (Next >= Body.Len() || Body[Next] != TEXT(':')) { Strings.Add(Body.Mid(Start, Index - Start)); }
+			}
+			else if (Depth == 0 && !FChar::IsWhitespace(Char)) { break; }
+		}
+		return Strings;
+	}
+
+	/**
+	 * Reads the first signature and the writable static accounts of a base64 transaction: the signers but the read-only
+	 * ones, then the other accounts but the read-only ones. Accounts loaded from lookup tables are not in the message.
+	 */
+	bool ReadTransactionAccounts(const FString& Transaction, FString& OutSignature, TArray<FString>& OutAccounts)
+	{
+		TArray<uint8> Bytes;
+		if (!FBase64::Decode(Transaction, Bytes)) { return false; }
+
+		FByteReader            Reader(Bytes);
+		int32                  SignatureCount;
+		TConstArrayView<uint8> Signature;
+		if (!Reader.ReadCompactU16(SignatureCount) || SignatureCount == 0 || !Reader.ReadView(64, Signature)
+			|| !Reader.Skip((SignatureCount - 1) * 64))
+		{
+			return false;
+		}
+
+		// Versioned messages start with their version, its top bit set.
+		uint8 Header[3];
+		if (!Reader.ReadU8(Header[0]) || ((Header[0] & 0x80) && !Reader.ReadU8(Header[0])) || !Reader.ReadU8(Header[1])
+			|| !Reader.ReadU8(Header[2]))
+		{
+			return false;
+		}
+
+		const int32 Signers = Header[0];
+		int32       KeyCount;
+		if (!Reader.ReadCompactU16(KeyCount) || Signers > KeyCount || Header[1] > Signers || Header[2] > KeyCount - Signers
+			|| Reader.Remaining() < KeyCount * 32)
+		{
+			return false;
+		}
+
+		OutSignature = FBase58::EncodeBase58(Signature.GetData(), Signature.Num());
+		for (int32 i = 0; i < KeyCount; i++)
+		{
+			const bool bWritable = i < Signers ? i < Signers - Header[1] : i < KeyCount - Header[2];
+			if (bWritable) { OutAccounts.Add(FBase58::EncodeBase58(Reader.GetData() + Reader.Tell() + i * 32, 32)); }
+		}
+		return true;
+	}
+
+	// The network and the body without the value of its id, the only part that differs between identical requests.
+	FString MakeKey(const FString& Body)
+	{
+		const UFoundationSettings* Settings = GetDefault<UFoundationSettings>();
+		FString Key = FString::Printf(TEXT("%d %s "), static_cast<int32>(Settings->GetNetwork()), *Settings->GetNetworkURL());
+
+		const FString IdField = TEXT("\"id\":");
+		const int32   IdStart = Body.Find(IdField, ESearchCase::CaseSensitive);
+		if (IdStart == INDEX_NONE) { return Key + Body; }
+
+		int32 IdEnd = IdStart + IdField.Len();
+		while (IdEnd < Body.Len() && (FChar::IsWhitespace(Body[IdEnd]) || FChar::IsDigit(Body[IdEnd]))) { IdEnd++; }
+		return Key + Body.Left(IdStart + IdField.Len()) + Body.Mid(IdEnd);
+	}
+
+	FString MakeTimeToLiveKey(const FString& Method, const FString& Commitment)
+	{
+		return Method + TEXT("/") + (Commitment.IsEmpty() ? DefaultCommitment : *Commitment);
+	}
+
+	TSharedPtr<FJsonObject> CopyObject(const FJsonObject& Object);
+
+	// Strings, numbers, booleans and null cannot be changed in place and stay shared.
+	TSharedPtr<FJsonValue> CopyValue(const TSharedPtr<FJsonValue>& Value)
+	{
+		if (!Value.IsValid()) { return Value; }
+
+		if (Value->Type == EJson::Object)
+		{
+			const TSharedPtr<FJsonObject> Object = Value->AsObject();
+			return Object.IsValid() ? MakeShared<FJsonValueObject>(CopyObject(*Object)) : Value;
+		}
+		if (Value->Type == EJson::Array)
+		{
+			TArray<TSharedPtr<FJsonValue>> Items;
+			for (const TSharedPtr<FJsonValue>& Item : Value->AsArray()) { Items.Add(CopyValue(Item)); }
+			return MakeShared<FJsonValueArray>(Items);
+		}
+		return Value;
+	}
+
+	// Copying an FJsonObject shares its nested objects and arrays, every waiter gets its own tree instead.
+	TSharedPtr<FJsonObject> CopyObject(const FJsonObject& Object)
+	{
+		const TSharedPtr<FJsonObject> Copy = MakeShared<FJsonObject>();
+		Copy->Values.Reserve(Object.Values.Num());
+		for (const auto& [Name, Value] : Object.Values) { Copy->Values.Add(Name, CopyValue(Value)); }
+		return Copy;
+	}
+
+	// Decodes on a worker and delivers on the game thread like FRequestManager, unless the request was cancelled meanwhile.
+	void DecodeAsync(const TSharedPtr<FRequestData>& RequestData, RequestDecoder Decoder, TSharedPtr<FJsonObject> Response)
+	{
+		AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [RequestData, Decoder = MoveTemp(Decoder), Response]()
+		{
+			AsyncTask(ENamedThreads::GameThread, [RequestData, Deliver = Decoder(*Response)]()
+			{
+				if (RequestData->Decoder) { Deliver(); }
+			});
+		});
+	}
+} // namespace
+
+FRequestCache& FRequestCache::Get()
+{
+	static FRequestCache Instance;
+	return Instance;
+}
+
+FRequestCache::FRequestCache()
+{
+	// Account reads, the calls a game repeats every frame or from every widget showing the same account.
+	for (const TCHAR* Method : { TEXT("getAccountInfo"), TEXT("getBalance"), TEXT("getMultipleAccounts"), TEXT("getTokenAccountsByOwner"),
+		     TEXT("getProgramAccounts") })
+	{
+		SetTimeToLive(Method, TEXT("processed"), 0.4);
+		SetTimeToLive(Method, TEXT("confirmed"), 1.0);
+		SetTimeToLive(Method, TEXT("finalized"), 4.0);
+	}
+}
+
+bool FRequestCache::Intercept(const TSharedPtr<FRequestData>& RequestData)
+{
+	// A streamed body goes to one caller only.
+	if (RequestData->BodyCallback.IsBound()) { return false; }
+
+	const FString Method = ReadStringField(RequestData->Body, TEXT("method"));
+	if (Method == TEXT("sendTransaction"))
+	{
+		WatchTransaction(RequestData);
+		return false;
+	}
+	if (!IsShareable(Method)) { return false; }
+
+	const FString Key = MakeKey(RequestData->Body);
+	const double  Now = FPlatformTime::Seconds();
+
+	TSharedPtr<FJsonObject>  Cached;
+	TSharedPtr<FRequestData> Shared;
+	{
+		FScopeLock ScopeLock(&Lock);
+		if (const FCachedResponse* Entry = Responses.Find(Key))
+		{
+			if (Entry->ExpiryTime > Now) { Cached = Entry->Response; }
+			else { Responses.Remove(Key); }
+		}
+
+		if (!Cached.IsValid())
+		{
+			if (FSharedRequest* Existing = InFlight.Find(Key))
+			{
+				Existing->Waiters.Add({ RequestData, RequestData->Decoder });
+				return true;
+			}
+
+			// The shared request keeps the first caller's id so batched responses are routed back to it.
+			Shared = MakeShared<FRequestData>();
+			Shared->Id = RequestData->Id;
+			Shared->Body = RequestData->Body;
+			Shared->Priority = RequestData->Priority;
+			Shared->bBypassCache = true;
+
+			FSharedRequest& Entry = InFlight.Add(Key);
+			Entry.Request = Shared;
+			Entry.Method = Method;
+			Entry.Params = ReadParamStrings(RequestData->Body);
+			Entry.Waiters.Add({ RequestData, RequestData->Decoder });
+			if (const double* TimeToLive = TimesToLive.Find(MakeTimeToLiveKey(Method, ReadStringField(RequestData->Body, TEXT("commitment")))))
+			{
+				Entry.TimeToLive = *TimeToLive;
+			}
+		}
+	}
+
+	if (Cached.IsValid() && RequestData->Decoder)
+	{
+		DecodeAsync(RequestData, RequestData->Decoder, CopyObject(*Cached));
+		return true;
+	}
+	if (Cached.IsValid())
+	{
+		// Callers expect their callback after SendRequest returns, never from inside it.
+		FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda([RequestData, Cached](float DeltaTime)
+		{
+			RequestData->Callback.ExecuteIfBound(*CopyObject(*Cached));
+			return false;
+		}));
+		return true;
+	}
+
+	// Behind a decoded request the shared one is decoded too, the response is parsed once for every waiter.
+	if (RequestData->Decoder)
+	{
+		Shared->Decoder = [this, Key](FJsonObject& Response) -> TFunction<void()>
+		{
+			const TSharedPtr<FJsonObject> Kept = CopyObject(Response);
+			return [this, Key, Kept, Decoded = DecodeForWaiters(Key, Response)]() mutable { OnResponse(Key, Kept.Get(), nullptr, &Decoded); };
+		};
+	}
+	Shared->Callback.BindLambda([this, Key](FJsonObject& Response) { OnResponse(Key, &Response, nullptr); });
+	Shared->ErrorCallback.BindLambda([this, Key](FString& Error) { OnResponse(Key, nullptr, &Error); });
+	FRequestManager::SendRequest(Shared);
+	return true;
+}
+
+FRequestCache::FDecodedResults FRequestCache::DecodeForWaiters(const FString& Key, FJsonObject& Response)
+{
+	TArray<FWaiter> Waiters;
+	{
+		FScopeLock ScopeLock(&Lock);
+		if (const FSharedRequest* Entry = InFlight.Find(Key))
+		{
+			Waiters = Entry->Waiters.FilterByPredicate([](const FWaiter& Waiter) { return static_cast<bool>(Waiter.Decoder); });
+		}
+	}
+
+	// Decoders may change the response, every one but the last gets its own copy.
+	FDecodedResults Decoded;
+	for (int32 i = 0; i < Waiters.Num(); i++)
+	{
+		if (i == Waiters.Num() - 1) { Decoded.Add(Waiters[i].Request.Get(), Waiters[i].Decoder(Response)); }
+		else { Decoded.Add(Waiters[i].Request.Get(), Waiters[i].Decoder(*CopyObject(Response))); }
+	}
+	return Decoded;
+}
+
+void FRequestCache::OnResponse(const FString& Key, FJsonObject* Response, FString* Error, FDecodedResults* Decoded)
+{
+	FSharedRequest Entry;
+	{
+		FScopeLock ScopeLock(&Lock);
+		if (!InFlight.RemoveAndCopyValue(Key, Entry)) { return; }
+
+		if (Response && Entry.TimeToLive > 0.0 && !Entry.bInvalidated)
+		{
+			const double Now = FPlatformTime::Seconds();
+			RemoveExpired(Now);
+
+			FCachedResponse Cached;
+			Cached.Response = CopyObject(*Response);
+			Cached.Method = MoveTemp(Entry.Method);
+			Cached.Params = Entry.Params;
+			Cached.ExpiryTime = Now + Entry.TimeToLive;
+			Responses.Add(Key, MoveTemp(Cached));
+		}
+	}
+
+	// Callbacks take a mutable object, so every waiter but the last gets a copy of the response.
+	for (int32 i = 0; i < Entry.Waiters.Num(); i++)
+	{
+		const FWaiter& Waiter = Entry.Waiters[i];
+		if (!Response)
+		{
+			FString WaiterError = *Error;
+			Waiter.Request->ErrorCallback.ExecuteIfBound(WaiterError);
+		}
+		else if (TFunction<void()>* Deliver = Decoded ? Decoded->Find(Waiter.Request.Get()) : nullptr)
+		{
+			if (Waiter.Request->Decoder) { (*Deliver)(); }
+		}
+		else if (Waiter.Decoder)
+		{
+			// Joined after the decoders ran, or behind a request without one.
+			DecodeAsync(Waiter.Request, Waiter.Decoder, CopyObject(*Response));
+		}
+		else if (i == Entry.Waiters.Num() - 1) { Waiter.Request->Callback.ExecuteIfBound(*Response); }
+		else { Waiter.Request->Callback.ExecuteIfBound(*CopyObject(*Response)); }
+	}
+}
+
+void FRequestCache::Cancel(FRequestData* RequestData)
+{
+	TSharedPtr<FRequestData> Orphan;
+	{
+		FScopeLock ScopeLock(&Lock);
+		FString    OrphanKey;
+		for (auto& [Key, Entry] : InFlight)
+		{
+			const int32 Removed = Entry.Waiters.RemoveAll([RequestData](const FWaiter& Waiter) { return Waiter.Request.Get() == RequestData; });
+			if (Removed > 0)
+			{
+				if (Entry.Waiters.IsEmpty())
+				{
+					Orphan = Entry.Request;
+					OrphanKey = Key;
+				}
+				break;
+			}
+		}
+		if (Orphan.IsValid()) { InFlight.Remove(OrphanKey); }
+	}
+
+	if (Orphan.IsValid())
+	{
+		FRequestManager::CancelRequest(Orphan.Get());
+	}
+}
+
+void FRequestCache::SetTimeToLive(const FString& Method, const FString& Commitment, double Seconds)
+{
+	FScopeLock ScopeLock(&Lock);
+	TimesToLive.Add(MakeTimeToLiveKey(Method, Commitment), FMath::Max(0.0, Seconds));
+}
+
+double FRequestCache::GetTimeToLive(const FString& Method, const FString& Commitment) const
+{
+	FScopeLock    ScopeLock(&Lock);
+	const double* Seconds = TimesToLive.Find(MakeTimeToLiveKey(Method, Commitment));
+	return Seconds ? *Seconds : 0.0;
+}
+
+void FRequestCache::Invalidate(const FString& Account)
+{
+	if (Account.IsEmpty()) { return; }
+
+	FScopeLock ScopeLock(&Lock);
+	TArray<FString> Keys;
+	for (const auto& [Key, Entry] : Responses)
+	{
+		if (Entry.Params.Contains(Account)) { Keys.Add(Key); }
+	}
+	for (const FString& Key : Keys) { Responses.Remove(Key); }
+
+	// Their responses may predate the change.
+	for (auto& [Key, Entry] : InFlight)
+	{
+		if (Entry.Params.Contains(Account)) { Entry.bInvalidated = true; }
+	}
+}
+
+void FRequestCache::InvalidateOnConfirmation(const FString& Signature, const TArray<FString>& Accounts)
+{
+	if (Signature.IsEmpty() || Accounts.IsEmpty()) { return; }
+
+	FScopeLock ScopeLock(&Lock);
+	PendingTransactions.Add({ Signature, Accounts, FPlatformTime::Seconds() + ConfirmationTimeout });
+	if (!ConfirmationHandle.IsValid())
+	{
+		ConfirmationHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda([this](float DeltaTime)
+		{
+			return PollConfirmations();
+		}), ConfirmationPollInterval);
+	}
+}
+
+void FRequestCache::InvalidateMethod(const FString& Method)
+{
+	FScopeLock ScopeLock(&Lock);
+	TArray<FString> Keys;
+	for (const auto& [Key, Entry] : Responses)
+	{
+		if (Entry.Method == Method) { Keys.Add(Key); }
+	}
+	for (const FString& Key : Keys) { Responses.Remove(Key); }
+
+	for (auto& [Key, Entry] : InFlight)
+	{
+		if (Entry.Method == Method) { Entry.bInvalidated = true; }
+	}
+}
+
+void FRequestCache::Clear()
+{
+	FScopeLock ScopeLock(&Lock);
+	Responses.Empty();
+	for (auto& [Key, Entry] : InFlight) { Entry.bInvalidated = true; }
+}
+
+void FRequestCache::WatchTransaction(const TSharedPtr<FRequestData>& RequestData)
+{
+	const TArray<FString> Params = ReadParamStrings(RequestData->Body);
+
+	FString         Signature;
+	TArray<FString> Accounts;
+	if (!Params.IsEmpty() && ReadTransactionAccounts(Params[0], Signature, Accounts))
+	{
+		InvalidateOnConfirmation(Signature, Accounts);
+	}
+}
+
+bool FRequestCache::PollConfirmations()
+{
+	TArray<FString> Signatures;
+	{
+		FScopeLock ScopeLock(&Lock);
+		const double Now = FPlatformTime::Seconds();
+		PendingTransactions.RemoveAll([Now](const FPendingTransaction& Pending) { return Pending.ExpiryTime <= Now; });
+		if (PendingTransactions.IsEmpty())
+		{
+			ConfirmationHandle.Reset();
+			return false;
+		}
+		if (bPollingConfirmations) { return true; }
+
+		for (int32 i = 0; i < PendingTransactions.Num() && i < MaxSignaturesPerPoll; i++) { Signatures.Add(PendingTransactions[i].Signature); }
+		bPollingConfirmations = true;
+	}
+
+	const TSharedPtr<FRequestData> Request = FRequestUtils::RequestSignatureStatuses(Signatures);
+	Request->Priority = ERequestPriority::Confirmation;
+	Request->bBypassCache = true;
+	Request->Callback.BindLambda([this, Signatures](FJsonObject& Response) { OnConfirmations(Signatures, &Response); });
+	Request->ErrorCallback.BindLambda([this, Signatures](FString& Error) { OnConfirmations(Signatures, nullptr); });
+	FRequestManager::SendRequest(Request);
+	return true;
+}
+
+void FRequestCache::OnConfirmations(const TArray<FString>& Signatures, const FJsonObject* Response)
+{
+	TArray<FString> Statuses;
+	if (Response && !FRequestUtils::ParseSignatureStatusesResponse(*Response, Statuses)) { Statuses.Reset(); }
+
+	TArray<FString> Accounts;
+	{
+		FScopeLock ScopeLock(&Lock);
+		bPollingConfirmations = false;
+
+		// A failed transaction still charged its fee payer.
+		for (int32 i = 0; i < Signatures.Num() && i < Statuses.Num(); i++)
+		{
+			if (Statuses[i] != TEXT("confirmed") && Statuses[i] != TEXT("finalized") && Statuses[i] != TEXT("failed")) { continue; }
+
+			const int32 Index = PendingTransactions.IndexOfByPredicate([&](const FPendingTransaction& Pending) { return Pending.Signature == Signatures[i]; });
+			if (Index != INDEX_NONE)
+			{
+				Accounts.Append(PendingTransactions[Index].Accounts);
+				PendingTransactions.RemoveAt(Index);
+			}
+		}
+	}
+
+	for (const FString& Account : Accounts) { Invalidate(Account); }
+}
+
+void FRequestCache::RemoveExpired(double Now)
+{
+	TArray<FString> Keys;
+	for (const auto& [Key, Entry] : Responses)
+	{
+		if (Entry.ExpiryTime <= Now) { Keys.Add(Key); }
+	}
+	for (const FString& Key : Keys) { Responses.Remove(Key); }
+}
@@ -21,6 +21,10 @@ Contributers: Daniele Calanna, Riccardo Torrisi
 #include "Network/RequestManager.h"
 
 #include "HttpModule.h"
+#include "Async/Async.h"
+#include "Containers/Queue.h"
+#include "Containers/Ticker.h"
+#include "Network/RequestCache.h"
 #include "Network/RequestUtils.h"
 #include "Interfaces/IHttpResponse.h"
 
@@ -40,7 +44,401 @@ FString PrettifyJson(const TSharedPtr<FJsonObject>& JsonObject)
 DECLARE_LOG_CATEGORY_CLASS(RequestManager, Log, All);
 
 int64 LastMessageID = 0;
-TArray<FRequestData*> PendingRequests;
+
+namespace
+{
+	// Passes the body of a streamed request to its BodyCallback as the HTTP module writes it.
+	class FResponseBodyStream : public FArchive
+	{
+	public:
+		explicit FResponseBodyStream(const TSharedPtr<FRequestData>& InRequestData)
+			: RequestData(InRequestData)
+		{
+			SetIsSaving(true);
+		}
+
+		virtual void Serialize(void* Data, int64 Length) override
+		{
+			// Runs on the HTTP thread, the lock keeps CancelRequest from clearing the callback mid-call.
+			FScopeLock ScopeLock(&RequestLock);
+			if (RequestData.IsValid())
+			{
+				RequestData->BodyCallback.ExecuteIfBound(TConstArrayView<uint8>(static_cast<const uint8*>(Data), static_cast<int32>(Length)));
+			}
+		}
+
+		// Drops the rest of the body, Serialize no longer touches the request once this returns.
+		void Detach()
+		{
+			FScopeLock ScopeLock(&RequestLock);
+			RequestData.Reset();
+		}
+
+	private:
+		FCriticalSection         RequestLock;
+		TSharedPtr<FRequestData> RequestData;
+	};
+
+	// One HTTP post, a single request or a JSON-RPC batch.
+	struct FPost
+	{
+		FString                          Url;
+		ERequestPriority                 Priority = ERequestPriority::Interactive;
+		TArray<TSharedPtr<FRequestData>> Requests;
+		// Set once the post is sent.
+		FHttpRequestPtr                  HttpRequest;
+		// Set for a request with a BodyCallback, even if the platform cannot stream and the body comes whole.
+		TSharedPtr<FResponseBodyStream>  BodyStream;
+		// Whether the HTTP module writes the body to BodyStream as it arrives.
+		bool                             bStreamingBody = false;
+	};
+
+	// Posts to one URL, waiting for a free slot in their priority's queue.
+	struct FEndpoint
+	{
+		int32                    InFlight = 0;
+		TArray<TSharedPtr<FPost>> Queues[static_cast<int32>(ERequestPriority::Count)];
+	};
+
+	// Guards everything below. Requests wait in PendingRequests for their batch window, then in their endpoint's queues
+	// for a slot.
+	FCriticalSection Lock;
+	TArray<TSharedPtr<FRequestData>> PendingRequests;
+	FTSTicker::FDelegateHandle FlushHandle;
+	TMap<FString, FEndpoint> Endpoints;
+	TArray<TSharedPtr<FPost>> InFlightPosts;
+	// Registered while decodes are outstanding, from the first one sent until the last result was delivered.
+	FTSTicker::FDelegateHandle DrainHandle;
+	int32 PendingDecodes = 0;
+
+	// Filled by decoding workers, drained on the game thread once per tick.
+	TQueue<TFunction<void()>, EQueueMode::Mpsc> DecodedResponses;
+
+	void Enqueue(TSharedPtr<FPost> Post);
+
+	FString GetRequestURL()
+	{
+		FString Url = GetDefault<UFoundationSettings>()->GetNetworkURL();
+		if (Url.IsEmpty())
+		{
+			Url = GetDefault<UFoundationSettings>()->GetNetwork() == ESolanaNetwork::DevNet
+				      ? "https://suzy-imihkz-fast-devnet.helius-rpc.com/"
+				      : "https://blisse-zgnb5y-fast-mainnet.helius-rpc.com/";
+		}
+		return Url;
+	}
+
+	FHttpRequestRef CreateHttpRequest(const FString& Url, const FString& Body)
+	{
+		const FHttpRequestRef Request = FHttpModule::Get().CreateRequest();
+		Request->SetURL(Url);
+		Request->SetVerb("POST");
+		Request->SetHeader(TEXT("Content-Type"), TEXT("application/json"));
+		Request->SetContentAsString(Body);
+		return Request;
+	}
+
+	TSharedPtr<FPost> MakePost(const FString& Url, ERequestPriority Priority, TArray<TSharedPtr<FRequestData>> Requests)
+	{
+		TSharedPtr<FPost> Post = MakeShared<FPost>();
+		Post->Url = Url;
+		Post->Priority = Priority;
+		Post->Requests = MoveTemp(Requests);
+		return Post;
+	}
+
+	void FailRequest(FRequestData& RequestData, const TCHAR* Message)
+	{
+		FString Error(Message);
+		RequestData.ErrorCallback.ExecuteIfBound(Error);
+	}
+
+	// Calls the callback matching one JSON-RPC response object.
+	void HandleResponse(FRequestData& RequestData, FJsonObject& Response)
+	{
+		const TSharedPtr<FJsonObject>* outObject;
+		if (!Response.TryGetObjectField("error", outObject))
+		{
+			RequestData.Callback.ExecuteIfBound(Response);
+		}
+		else
+		{
+			const TSharedPtr<FJsonObject> ErrorObjectField = Response.GetObjectField("error");
+			const TSharedPtr<FJsonObject> DataStringField = ErrorObjectField->GetObjectField("data");
+			const FString PrettyDataField = PrettifyJson(DataStringField);
+
+			UE_LOG(LogTemp, Error, TEXT("Request Error: %s, data: %s"),
+			       *ErrorObjectField->GetStringField("message"), *PrettyDataField);
+			auto MessageString = ErrorObjectField->GetStringField("message");
+			RequestData.ErrorCallback.ExecuteIfBound(MessageString);
+		}
+	}
+
+	void HandleSingleResponse(FRequestData& RequestData, const FHttpResponsePtr& Response, bool bSuccess)
+	{
+		if (!bSuccess || !Response.IsValid())
+		{
+			UE_LOG(LogTemp, Error, TEXT("Http Request Failed"));
+			FailRequest(RequestData, TEXT("Http Request Failed"));
+			return;
+		}
+
+		TSharedPtr<FJsonObject> ParsedJSON;
+		const TSharedRef<TJsonReader<TCHAR>> Reader = TJsonReaderFactory<>::Create(Response->GetContentAsString());
+		if (FJsonSerializer::Deserialize(Reader, ParsedJSON))
+		{
+			HandleResponse(RequestData, *ParsedJSON);
+		}
+		else
+		{
+			UE_LOG(LogTemp, Error, TEXT("Failed to parse Response from the server"));
+			FailRequest(RequestData, TEXT("Failed to parse response from the server"));
+		}
+	}
+
+	// Returns false, removing the ticker, once every outstanding decode was delivered.
+	bool DrainDecodedResponses()
+	{
+		int32 Delivered = 0;
+		TFunction<void()> OnGameThread;
+		while (DecodedResponses.Dequeue(OnGameThread))
+		{
+			OnGameThread();
+			Delivered++;
+		}
+
+		FScopeLock ScopeLock(&Lock);
+		PendingDecodes -= Delivered;
+		if (PendingDecodes > 0) { return true; }
+
+		DrainHandle.Reset();
+		return false;
+	}
+
+	// Parsing and decoding run on a worker, only the decoded result comes back to the game thread.
+	void HandleDecodedResponse(const TSharedPtr<FRequestData>& RequestData, const FHttpResponsePtr& Response, bool bSuccess)
+	{
+		if (!bSuccess || !Response.IsValid())
+		{
+			UE_LOG(LogTemp, Error, TEXT("Http Request Failed"));
+			FailRequest(*RequestData, TEXT("Http Request Failed"));
+			return;
+		}
+
+		{
+			FScopeLock ScopeLock(&Lock);
+			PendingDecodes++;
+			if (!DrainHandle.IsValid())
+			{
+				DrainHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda([](float DeltaTime)
+				{
+					return DrainDecodedResponses();
+				}));
+			}
+		}
+
+		// The worker gets its own copy of the decoder, cancelling the request clears the original.
+		AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [RequestData, Response, Decoder = RequestData->Decoder]()
+		{
+			TFunction<void()> OnGameThread;
+
+			TSharedPtr<FJsonObject> ParsedJSON;
+			const TSharedRef<TJsonReader<TCHAR>> Reader = TJsonReaderFactory<>::Create(Response->GetContentAsString());
+			const TSharedPtr<FJsonObject>* ErrorObject;
+			if (!FJsonSerializer::Deserialize(Reader, ParsedJSON))
+			{
+				OnGameThread = [RequestData]()
+				{
+					UE_LOG(LogTemp, Error, TEXT("Failed to parse Response from the server"));
+					FailRequest(*RequestData, TEXT("Failed to parse response from the server"));
+				};
+			}
+			else if (ParsedJSON->TryGetObjectField("error", ErrorObject))
+			{
+				OnGameThread = [RequestData, ParsedJSON]() { HandleResponse(*RequestData, *ParsedJSON); };
+			}
+			else
+			{
+				OnGameThread = [RequestData, Deliver = Decoder(*ParsedJSON)]()
+				{
+					if (RequestData->Decoder) { Deliver(); }
+				};
+			}
+
+			DecodedResponses.Enqueue(MoveTemp(OnGameThread));
+		});
+	}
+
+	// The body already went to BodyCallback, unless the platform could not stream it.
+	void HandleStreamedResponse(const FPost& Post, const FHttpResponsePtr& Response, bool bSuccess)
+	{
+		FRequestData& RequestData = *Post.Requests[0];
+		if (!bSuccess || !Response.IsValid())
+		{
+			UE_LOG(LogTemp, Error, TEXT("Http Request Failed"));
+			FailRequest(RequestData, TEXT("Http Request Failed"));
+			return;
+		}
+
+		if (!Post.bStreamingBody) { RequestData.BodyCallback.ExecuteIfBound(Response->GetContent()); }
+
+		FJsonObject Empty;
+		RequestData.Callback.ExecuteIfBound(Empty);
+	}
+
+	// Routes every response of a batch back to its request by id.
+	void HandleBatchResponse(const FPost& Post, const FHttpResponsePtr& Response, bool bSuccess)
+	{
+		const TArray<TSharedPtr<FRequestData>>& Batch = Post.Requests;
+		if (!bSuccess || !Response.IsValid())
+		{
+			UE_LOG(LogTemp, Error, TEXT("Http Request Failed for a batch of %d requests"), Batch.Num());
+			for (const TSharedPtr<FRequestData>& RequestData : Batch) { FailRequest(*RequestData, TEXT("Http Request Failed")); }
+			return;
+		}
+
+		TArray<TSharedPtr<FJsonValue>> Responses;
+		const TSharedRef<TJsonReader<TCHAR>> Reader = TJsonReaderFactory<>::Create(Response->GetContentAsString());
+		if (!FJsonSerializer::Deserialize(Reader, Responses))
+		{
+			// Providers without batch support answer with a single error object.
+			UE_LOG(LogTemp, Warning, TEXT("Batch of %d requests rejected by %s, sending them one by one"), Batch.Num(), *Post.Url);
+			for (const TSharedPtr<FRequestData>& RequestData : Batch) { Enqueue(MakePost(Post.Url, Post.Priority, { RequestData })); }
+			return;
+		}
+
+		// Responses may come in any order.
+		TBitArray<> Answered(false, Batch.Num());
+		for (const TSharedPtr<FJsonValue>& Value : Responses)
+		{
+			const TSharedPtr<FJsonObject>* Object;
+			uint32 Id;
+			if (!Value.IsValid() || !Value->TryGetObject(Object) || !(*Object)->TryGetNumberField(TEXT("id"), Id))
+			{
+				continue;
+			}
+
+			const int32 Index = Batch.IndexOfByPredicate([Id](const TSharedPtr<FRequestData>& RequestData) { return RequestData->Id == Id; });
+			if (Index != INDEX_NONE && !Answered[Index])
+			{
+				Answered[Index] = true;
+				HandleResponse(*Batch[Index], **Object);
+			}
+		}
+
+		for (int32 i = 0; i < Batch.Num(); i++)
+		{
+			if (!Answered[i])
+			{
+				UE_LOG(LogTemp, Error, TEXT("No response for request %u in batch"), Batch[i]->Id);
+				FailRequest(*Batch[i], TEXT("Missing response in batch"));
+			}
+		}
+	}
+
+	void OnPostComplete(const TSharedPtr<FPost>& Post, const FHttpResponsePtr& Response, bool bSuccess);
+
+	// Sends queued posts, highest priority first, while the endpoint has free slots. Background posts leave the last
+	// slot free so a transaction never waits behind a burst of polls. With a single slot they share it, they only start
+	// once every higher priority queue is empty.
+	void Pump(const FString& Url)
+	{
+		const int32 MaxInFlight = GetDefault<UFoundationSettings>()->GetMaxRequestsInFlight();
+		const int32 BackgroundSlots = MaxInFlight > 1 ? MaxInFlight - 1 : MaxInFlight;
+
+		TArray<FHttpRequestRef> Starting;
+		{
+			FScopeLock ScopeLock(&Lock);
+			FEndpoint& Endpoint = Endpoints.FindOrAdd(Url);
+			for (int32 Priority = 0; Priority < static_cast<int32>(ERequestPriority::Count); Priority++)
+			{
+				const int32 Slots = Priority == static_cast<int32>(ERequestPriority::Background) ? BackgroundSlots : MaxInFlight;
+				TArray<TSharedPtr<FPost>>& Queue = Endpoint.Queues[Priority];
+				int32 Started = 0;
+				while (Started < Queue.Num() && Endpoint.InFlight < Slots)
+				{
+					const TSharedPtr<FPost> Post = Queue[Started++];
+
+					FString Body;
+					if (Post->Requests.Num() == 1)
+					{
+						Body = Post->Requests[0]->Body;
+					}
+					else
+					{
+						Body.AppendChar(TEXT('['));
+						for (int32 i = 0; i < Post->Requests.Num(); i++)
+						{
+							if (i > 0) { Body.AppendChar(TEXT(',')); }
+							Body.Append(Post->Requests[i]->Body);
+						}
+						Body.AppendChar(TEXT(']'));
+					}
+
+					const FHttpRequestRef Request = CreateHttpRequest(Url, Body);
+					if (Post->Requests.Num() == 1 && Post->Requests[0]->BodyCallback.IsBound())
+					{
+						Post->BodyStream = MakeShared<FResponseBodyStream>(Post->Requests[0]);
+						Post->bStreamingBody = Request->SetResponseBodyReceiveStream(Post->BodyStream.ToSharedRef());
+					}
+					Request->OnProcessRequestComplete().BindLambda(
+						[Post](FHttpRequestPtr InRequest, const FHttpResponsePtr& Response, const bool bSuccess)
+						{
+							OnPostComplete(Post, Response, bSuccess);
+						});
+
+					Post->HttpRequest = Request;
+					InFlightPosts.Add(Post);
+					Endpoint.InFlight++;
+					Starting.Add(Request);
+				}
+				if (Started > 0) { Queue.RemoveAt(0, Started); }
+			}
+		}
+
+		for (const FHttpRequestRef& Request : Starting) { Request->ProcessRequest(); }
+	}
+
+	void OnPostComplete(const TSharedPtr<FPost>& Post, const FHttpResponsePtr& Response, bool bSuccess)
+	{
+		{
+			FScopeLock ScopeLock(&Lock);
+			Endpoints.FindOrAdd(Post->Url).InFlight--;
+			InFlightPosts.Remove(Post);
+			Post->HttpRequest.Reset();
+		}
+
+		// The slot is handed on before the callbacks run, they often send follow-up requests.
+		Pump(Post->Url);
+
+		if (Post->BodyStream.IsValid())
+		{
+			HandleStreamedResponse(*Post, Response, bSuccess);
+		}
+		else if (Post->Requests.Num() == 1 && Post->Requests[0]->Decoder)
+		{
+			HandleDecodedResponse(Post->Requests[0], Response, bSuccess);
+		}
+		else if (Post->Requests.Num() == 1)
+		{
+			HandleSingleResponse(*Post->Requests[0], Response, bSuccess);
+		}
+		else
+		{
+			HandleBatchResponse(*Post, Response, bSuccess);
+		}
+	}
+
+	void Enqueue(TSharedPtr<FPost> Post)
+	{
+		const FString Url = Post->Url;
+		{
+			FScopeLock ScopeLock(&Lock);
+			Endpoints.FindOrAdd(Url).Queues[static_cast<int32>(Post->Priority)].Add(MoveTemp(Post));
+		}
+		Pump(Url);
+	}
+}
 
 int64 FRequestManager::GetNextMessageId()
 {
@@ -54,68 +452,125 @@ int64 FRequestManager::GetLastMessageId()
 
 void FRequestManager::SendRequest(TSharedPtr<FRequestData> RequestData)
 {
-	const FHttpRequestRef Request = FHttpModule::Get().CreateRequest();
-	FString Url = GetDefault<UFoundationSettings>()->GetNetworkURL();
-	if (Url.IsEmpty())
+	if (!RequestData->bBypassCache && FRequestCache::Get().Intercept(RequestData)) { return; }
+
+	const UFoundationSettings* Settings = GetDefault<UFoundationSettings>();
+	const int32 MaxBatchSize = Settings->GetMaxRequestBatchSize();
+
+	// Transactions do not wait for a batch window, and streamed or decoded responses cannot share their post.
+	if (MaxBatchSize <= 1 || RequestData->Priority == ERequestPriority::Transaction || RequestData->BodyCallback.IsBound()
+		|| RequestData->Decoder)
+	{
+		Enqueue(MakePost(GetRequestURL(), RequestData->Priority, { RequestData }));
+		return;
+	}
+
+	bool bBatchFull;
+	{
+		FScopeLock ScopeLock(&Lock);
+		PendingRequests.Add(MoveTemp(RequestData));
+		bBatchFull = PendingRequests.Num() >= MaxBatchSize;
+		if (!bBatchFull && !FlushHandle.IsValid())
+		{
+			FlushHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda([](float DeltaTime)
+			{
+				Flush();
+				return false;
+			}), Settings->GetRequestBatchWindow());
+		}
+	}
+
+	// A full batch has nothing left to wait for.
+	if (bBatchFull)
+	{
+		Flush();
+	}
+}
+
+void FRequestManager::Flush()
+{
+	TArray<TSharedPtr<FRequestData>> Requests;
 	{
-		Url = GetDefault<UFoundationSettings>()->GetNetwork() == ESolanaNetwork::DevNet
-			      ? "https://suzy-imihkz-fast-devnet.helius-rpc.com/"
-			      : "https://blisse-zgnb5y-fast-mainnet.helius-rpc.com/";
+		FScopeLock ScopeLock(&Lock);
+		Requests = MoveTemp(PendingRequests);
+		if (FlushHandle.IsValid())
+		{
+			FTSTicker::GetCoreTicker().RemoveTicker(FlushHandle);
+			FlushHandle.Reset();
+		}
 	}
-	Request->SetURL(Url);
-	Request->SetVerb("POST");
-	Request->SetHeader(TEXT("Content-Type"), TEXT("application/json"));
-	Request->SetContentAsString(RequestData->Body);
+	if (Requests.IsEmpty()) { return; }
 
-	Request->OnProcessRequestComplete().BindLambda(
-		[RequestData](FHttpRequestPtr InRequest, const FHttpResponsePtr& Response, const bool bSuccess)
+	// Batches only hold requests of one priority.
+	const FString Url = GetRequestURL();
+	const int32 MaxBatchSize = FMath::Max(1, GetDefault<UFoundationSettings>()->GetMaxRequestBatchSize());
+	for (int32 Priority = 0; Priority < static_cast<int32>(ERequestPriority::Count); Priority++)
+	{
+		TArray<TSharedPtr<FRequestData>> Batch;
+		for (const TSharedPtr<FRequestData>& RequestData : Requests)
 		{
-			if (!bSuccess)
+			if (static_cast<int32>(RequestData->Priority) != Priority) { continue; }
+
+			Batch.Add(RequestData);
+			if (Batch.Num() == MaxBatchSize)
 			{
-				FString RequestFailed(TEXT("Http Request Failed"));
-				UE_LOG(LogTemp, Error, TEXT("Http Request Failed"));
-				RequestData->ErrorCallback.ExecuteIfBound(RequestFailed);
+				Enqueue(MakePost(Url, RequestData->Priority, MoveTemp(Batch)));
+				Batch.Reset();
 			}
+		}
+		if (!Batch.IsEmpty())
+		{
+			Enqueue(MakePost(Url, static_cast<ERequestPriority>(Priority), MoveTemp(Batch)));
+		}
+	}
+}
 
-			TSharedPtr<FJsonObject> ParsedJSON;
-			const TSharedRef<TJsonReader<TCHAR>> Reader = TJsonReaderFactory<>::Create(
-				Response.Get()->GetContentAsString());
+void FRequestManager::CancelRequest(FRequestData* RequestData)
+{
+	if (!RequestData) { return; }
+
+	// Queued requests are not sent at all, and a post sent for this request alone is aborted.
+	FHttpRequestPtr Abort;
+	{
+		FScopeLock ScopeLock(&Lock);
+		const auto IsCancelled = [RequestData](const TSharedPtr<FRequestData>& Request) { return Request.Get() == RequestData; };
 
-			if (FJsonSerializer::Deserialize(Reader, ParsedJSON))
+		PendingRequests.RemoveAll(IsCancelled);
+		for (auto& [Url, Endpoint] : Endpoints)
+		{
+			for (TArray<TSharedPtr<FPost>>& Queue : Endpoint.Queues)
 			{
-				const TSharedPtr<FJsonObject>* outObject;
-				if (!ParsedJSON->TryGetObjectField("error", outObject))
-				{
-					RequestData->Callback.ExecuteIfBound(*ParsedJSON);
-				}
-				else
-				{
-					const TSharedPtr<FJsonObject> ErrorObjectField = ParsedJSON->GetObjectField("error");
-					const TSharedPtr<FJsonObject> DataStringField = ErrorObjectField->GetObjectField("data");
-					const FString PrettyDataField = PrettifyJson(DataStringField);
-
-					UE_LOG(LogTemp, Error, TEXT("Request Error: %s, data: %s"),
-					       *ErrorObjectField->GetStringField("message"), *PrettyDataField);
-					auto MessageString = ErrorObjectField->GetStringField("message");
-					RequestData->ErrorCallback.ExecuteIfBound(MessageString);
-				}
+				for (const TSharedPtr<FPost>& Post : Queue) { Post->Requests.RemoveAll(IsCancelled); }
+				Queue.RemoveAll([](const TSharedPtr<FPost>& Post) { return Post->Requests.IsEmpty(); });
 			}
-			else
+		}
+		for (const TSharedPtr<FPost>& Post : InFlightPosts)
+		{
+			if (Post->Requests.Num() == 1 && IsCancelled(Post->Requests[0]))
 			{
-				FString ParseFailure(TEXT("Failed to parse response from the server"));
-				UE_LOG(LogTemp, Error, TEXT("Failed to parse Response from the server"));
-				RequestData->ErrorCallback.ExecuteIfBound(ParseFailure);
+				Abort = Post->HttpRequest;
+				if (Post->BodyStream.IsValid()) { Post->BodyStream->Detach(); }
 			}
-		});
+		}
+	}
 
-	Request->ProcessRequest();
-}
+	// The body stream let go of the request above, nothing reads these from another thread anymore.
+	RequestData->Callback.Unbind();
+	RequestData->ErrorCallback.Unbind();
+	RequestData->BodyCallback.Unbind();
+	RequestData->Decoder = nullptr;
+	FRequestCache::Get().Cancel(RequestData);
 
-void FRequestManager::CancelRequest(FRequestData* RequestData)
-{
-	if (RequestData)
+	if (Abort.IsValid())
 	{
-		RequestData->Callback.Unbind();
-		RequestData->ErrorCallback.Unbind();
+		Abort->CancelRequest();
 	}
 }
+
+void FRequestManager::WarmUp()
+{
+	// getHealth is the cheapest call there is, only the connection it leaves open matters.
+	const FHttpRequestRef Request = CreateHttpRequest(GetRequestURL(),
+		FString::Printf(TEXT(R"({"jsonrpc":"2.0","id":%u,"method":"getHealth"})"), static_cast<uint32>(GetNextMessageId())));
+	Request->ProcessRequest();
+}
@@ -19,6 +19,7 @@ Author: Jon Sawler
 #include "Network/RequestUtils.h"
 
 #include "JsonObjectConverter.h"
+#include "Network/ProgramAccountsParser.h"
 #include "Network/RequestManager.h"
 #include "Misc/MessageDialog.h"
 #include "SolanaUtils/Utils/Types.h"
@@ -157,14 +158,28 @@ TArray<FProgramAccountJson> FRequestUtils::ParseProgramAccountsResponse(const FJ
 		{
 			FProgramAccountJson AccountData;
 			FJsonObjectConverter::JsonObjectToUStruct(Account.ToSharedRef(), &AccountData);
+			AccountData.pubkey = EntryObject->GetStringField("pubkey");
 			List.Add(AccountData);
 		}
-		FString PubKey = EntryObject->GetStringField("pubkey");
 	}
 
 	return List;
 }
 
+void FRequestUtils::StreamProgramAccountsResponse(FRequestData& Request, TFunction<void(const FProgramAccountView&)> Sink,
+                                                  TFunction<void(const FString& Error)> OnComplete)
+{
+	const TSharedRef<FProgramAccountsParser> Parser = MakeShared<FProgramAccountsParser>(MoveTemp(Sink));
+
+	Request.BodyCallback.BindLambda([Parser](TConstArrayView<uint8> Chunk) { Parser->Feed(Chunk); });
+	Request.Callback.BindLambda([Parser, OnComplete](FJsonObject& Data)
+	{
+		Parser->Finish();
+		OnComplete(Parser->GetError());
+	});
+	Request.ErrorCallback.BindLambda([OnComplete](FString& Error) { OnComplete(Error); });
+}
+
 TSharedPtr<FRequestData> FRequestUtils::RequestMultipleAccounts(const TArray<FString>& PubKey)
 {
 	auto Request = MakeShared<FRequestData>();
@@ -203,10 +218,12 @@ TSharedPtr<FRequestData> FRequestUtils::SendTransaction(const FString& Transacti
 {
 	auto Request = MakeShared<FRequestData>();
 
+	// Preflight runs at "finalized" by default, where a hash from FBlockhashCache, taken at "confirmed", is not known yet.
 	Request->Body =
 		FString::Printf(
-			TEXT(R"({"jsonrpc":"2.0","id":%d,"method":"sendTransaction","params":["%s",{"encoding": "base64"}]})")
+			TEXT(R"({"jsonrpc":"2.0","id":%d,"method":"sendTransaction","params":["%s",{"encoding": "base64","preflightCommitment":"confirmed"}]})")
 			, Request->Id, *Transaction);
+	Request->Priority = ERequestPriority::Transaction;
 
 	return Request;
 }
@@ -216,13 +233,54 @@ FString FRequestUtils::ParseTransactionResponse(const FJsonObject& Data)
 	return Data.GetStringField("result");
 }
 
+TSharedPtr<FRequestData> FRequestUtils::SimulateTransaction(const FString& Transaction)
+{
+	auto Request = MakeShared<FRequestData>();
+
+	Request->Body =
+		FString::Printf(
+			TEXT(R"({"jsonrpc":"2.0","id":%d,"method":"simulateTransaction","params":["%s",{"encoding":"base64","commitment":"confirmed","sigVerify":false,"replaceRecentBlockhash":true}]})")
+			, Request->Id, *Transaction);
+
+	return Request;
+}
+
+bool FRequestUtils::ParseSimulateTransactionResponse(const FJsonObject& Data, uint64& OutUnitsConsumed)
+{
+	const TSharedPtr<FJsonObject>* Result;
+	const TSharedPtr<FJsonObject>* Value;
+	int64                          UnitsConsumed;
+	if (!Data.TryGetObjectField(TEXT("result"), Result) || !(*Result)->TryGetObjectField(TEXT("value"), Value)
+		|| !(*Value)->TryGetNumberField(TEXT("unitsConsumed"), UnitsConsumed))
+	{
+		UE_LOG(LogTemp, Error, TEXT("Unexpected simulateTransaction response"));
+		return false;
+	}
+
+	const TSharedPtr<FJsonValue> Error = (*Value)->TryGetField(TEXT("err"));
+	if (Error.IsValid() && !Error->IsNull())
+	{
+		UE_LOG(LogTemp, Error, TEXT("Transaction simulation failed after %lld compute units"), UnitsConsumed);
+
+		const TArray<TSharedPtr<FJsonValue>>* Logs;
+		if ((*Value)->TryGetArrayField(TEXT("logs"), Logs))
+		{
+			for (const TSharedPtr<FJsonValue>& Log : *Logs) { UE_LOG(LogTemp, Error, TEXT("  %s"), *Log->AsString()); }
+		}
+		return false;
+	}
+
+	OutUnitsConsumed = UnitsConsumed;
+	return true;
+}
+
 TSharedPtr<FRequestData> FRequestUtils::RequestBlockHash()
 {
 	auto Request = MakeShared<FRequestData>();
 
 	Request->Body =
 		FString::Printf(
-			TEXT(R"({"id":%d,"jsonrpc":"2.0","method":"getRecentBlockhash","params":[{"commitment":"finalized"}]})")
+			TEXT(R"({"id":%d,"jsonrpc":"2.0","method":"getLatestBlockhash","params":[{"commitment":"confirmed"}]})")
 			, Request->Id);
 
 	return Request;
@@ -239,6 +297,43 @@ FString FRequestUtils::ParseBlockHashResponse(const FJsonObject& Data)
 	return Hash;
 }
 
+bool FRequestUtils::ParseLatestBlockHashResponse(const FJsonObject& Data, FString& OutBlockHash, uint64& OutLastValidBlockHeight)
+{
+	const TSharedPtr<FJsonObject>* Result;
+	const TSharedPtr<FJsonObject>* Value;
+	int64                          LastValidBlockHeight;
+	if (!Data.TryGetObjectField(TEXT("result"), Result) || !(*Result)->TryGetObjectField(TEXT("value"), Value)
+		|| !(*Value)->TryGetStringField(TEXT("blockhash"), OutBlockHash)
+		|| !(*Value)->TryGetNumberField(TEXT("lastValidBlockHeight"), LastValidBlockHeight))
+	{
+		return false;
+	}
+
+	OutLastValidBlockHeight = LastValidBlockHeight;
+	return true;
+}
+
+TSharedPtr<FRequestData> FRequestUtils::RequestBlockHeight()
+{
+	auto Request = MakeShared<FRequestData>();
+
+	Request->Body =
+		FString::Printf(
+			TEXT(R"({"id":%d,"jsonrpc":"2.0","method":"getBlockHeight","params":[{"commitment":"confirmed"}]})")
+			, Request->Id);
+
+	return Request;
+}
+
+bool FRequestUtils::ParseBlockHeightResponse(const FJsonObject& Data, uint64& OutBlockHeight)
+{
+	int64 BlockHeight;
+	if (!Data.TryGetNumberField(TEXT("result"), BlockHeight) || BlockHeight <= 0) { return false; }
+
+	OutBlockHeight = BlockHeight;
+	return true;
+}
+
 TSharedPtr<FRequestData> FRequestUtils::GetTransactionFeeAmount(const FString& transaction)
 {
 	auto Request = MakeShared<FRequestData>();
@@ -273,6 +368,59 @@ TSharedPtr<FRequestData> FRequestUtils::RequestAirDrop(const FString& PubKey)
 	return Request;
 }
 
+TSharedPtr<FRequestData> FRequestUtils::RequestSignatureStatuses(const TArray<FString>& Signatures)
+{
+	auto Request = MakeShared<FRequestData>();
+
+	FString List;
+	for (const FString& Signature : Signatures)
+	{
+		if (!List.IsEmpty()) { List.Append(TEXT(",")); }
+		List.Append(FString::Printf(TEXT(R"("%s")"), *Signature));
+	}
+
+	Request->Body =
+		FString::Printf(
+			TEXT(R"({"jsonrpc":"2.0","id":%d,"method":"getSignatureStatuses","params":[[%s],{"searchTransactionHistory":true}]})")
+			, Request->Id, *List);
+
+	return Request;
+}
+
+bool FRequestUtils::ParseSignatureStatusesResponse(const FJsonObject& Data, TArray<FString>& OutStatuses)
+{
+	const TSharedPtr<FJsonObject>*       Result;
+	const TArray<TSharedPtr<FJsonValue>>* Values;
+	if (!Data.TryGetObjectField(TEXT("result"), Result) || !(*Result)->TryGetArrayField(TEXT("value"), Values))
+	{
+		UE_LOG(LogTemp, Error, TEXT("Unexpected getSignatureStatuses response"));
+		return false;
+	}
+
+	OutStatuses.Reset(Values->Num());
+	for (const TSharedPtr<FJsonValue>& Value : *Values)
+	{
+		const TSharedPtr<FJsonObject>* Status;
+		if (!Value.IsValid() || !Value->TryGetObject(Status))
+		{
+			OutStatuses.Add(FString());
+			continue;
+		}
+
+		const TSharedPtr<FJsonValue> Error = (*Status)->TryGetField(TEXT("err"));
+		if (Error.IsValid() && !Error->IsNull())
+		{
+			OutStatuses.Add(TEXT("failed"));
+			continue;
+		}
+
+		FString ConfirmationStatus;
+		(*Status)->TryGetStringField(TEXT("confirmationStatus"), ConfirmationStatus);
+		OutStatuses.Add(ConfirmationStatus);
+	}
+	return true;
+}
+
 void FRequestUtils::DisplayError(const FString& error)
 {
 	FMessageDialog::Open(EAppMsgType::Ok, FText::FromString(error), &ErrorTitle);
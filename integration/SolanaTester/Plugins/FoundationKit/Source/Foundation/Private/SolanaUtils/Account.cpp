@@ -25,21 +25,71 @@ Contributors: Jon Sawler, Daniele Calanna, Riccardo Torrisi
 FAccount::FAccount()
 {
 	PublicKeyData.SetNum(PublicKeySize);
-	PrivateKeyData.SetNum(PrivateKeySize);
 }
 
-TArray<uint8> FAccount::Sign(const TArray<uint8>& Transaction)
+void FAccount::PostSerialize(const FArchive& Ar)
+{
+	if (Ar.IsLoading())
+	{
+		Key = PublicKeyData.Num() == PublicKeySize ? FPublicKey(PublicKeyData) : FPublicKey(PublicKey);
+		if (HasPrivateKey())
+		{
+			SigningKey = FSigningKey(PrivateKeyData);
+		}
+		// Some saves were written while the strings were only encoded on demand.
+		if (PublicKey.IsEmpty() || (PrivateKey.IsEmpty() && HasPrivateKey()))
+		{
+			EncodeKeyStrings();
+		}
+	}
+}
+
+void FAccount::EncodeKeyStrings()
+{
+	PublicKey = Key.ToBase58();
+	PrivateKey = HasPrivateKey() ? FBase58::EncodeBase58(PrivateKeyData.GetData(), PrivateKeyData.Num()) : FString();
+}
+
+bool FAccount::HasPrivateKey() const
+{
+	// Saves made before public key accounts dropped their private key hold 64 zero bytes instead.
+	if (PrivateKeyData.Num() != PrivateKeySize) { return false; }
+	for (const uint8 Byte : PrivateKeyData)
+	{
+		if (Byte != 0) { return true; }
+	}
+	return false;
+}
+
+TArray<uint8> FAccount::Sign(const TArray<uint8>& Transaction) const
 {
 	TArray<uint8> Signature;
-	Signature.SetNum(PrivateKeySize);
-	TArray<uint8> Message;
-	FCryptoUtils::SignMessage(Signature, Transaction, PrivateKeyData);
+	Signature.SetNumUninitialized(FSigningKey::SignatureSize);
+	Sign(Transaction.GetData(), Transaction.Num(), Signature.GetData());
 	return Signature;
 }
 
-void FAccount::Verify(const TArray<uint8>& Transaction, const TArray<uint8>& Signature)
+void FAccount::Sign(const uint8* Message, int32 MessageSize, uint8* OutSignature) const
+{
+	if (SigningKey.IsValid())
+	{
+		SigningKey.Sign(Message, MessageSize, OutSignature);
+		return;
+	}
+
+	// Accounts whose private key was filled in by hand have no expanded key yet.
+	if (!HasPrivateKey())
+	{
+		UE_LOG(LogTemp, Error, TEXT("%s has no private key to sign with"), *GetPublicKeyString());
+		FMemory::Memzero(OutSignature, FSigningKey::SignatureSize);
+		return;
+	}
+	FSigningKey(PrivateKeyData).Sign(Message, MessageSize, OutSignature);
+}
+
+bool FAccount::Verify(const TArray<uint8>& Transaction, const TArray<uint8>& Signature) const
 {
-	FCryptoUtils::VerifyMessage(Signature, Transaction, PublicKeyData);
+	return FCryptoUtils::VerifyMessage(Signature, Transaction, PublicKeyData);
 }
 
 FAccount FAccount::FromSeed(const TArray<uint8>& Seed)
@@ -48,10 +98,11 @@ FAccount FAccount::FromSeed(const TArray<uint8>& Seed)
 
 	FAccount newAccount;
 
+	newAccount.PrivateKeyData.SetNumUninitialized(PrivateKeySize);
 	FCryptoUtils::GenerateKeyPair(Seed, newAccount.PublicKeyData, newAccount.PrivateKeyData);
-
-	newAccount.PublicKey = FBase58::EncodeBase58(newAccount.PublicKeyData.GetData(), newAccount.PublicKeyData.Num());
-	newAccount.PrivateKey = FBase58::EncodeBase58(newAccount.PrivateKeyData.GetData(), newAccount.PrivateKeyData.Num());
+	newAccount.Key = FPublicKey(newAccount.PublicKeyData);
+	newAccount.SigningKey = FSigningKey(newAccount.PrivateKeyData);
+	newAccount.EncodeKeyStrings();
 
 	return newAccount;
 }
@@ -67,8 +118,9 @@ FAccount FAccount::FromPrivateKey(const FString& privateKey)
 	{
 		newAccount.PublicKeyData[i] = newAccount.PrivateKeyData[i + PublicKeySize];
 	}
-
-	newAccount.PublicKey = FBase58::EncodeBase58(newAccount.PublicKeyData.GetData(), newAccount.PublicKeyData.Num());
+	newAccount.Key = FPublicKey(newAccount.PublicKeyData);
+	newAccount.PublicKey = newAccount.Key.ToBase58();
+	newAccount.SigningKey = FSigningKey(newAccount.PrivateKeyData);
 
 	return newAccount;
 }
@@ -82,9 +134,9 @@ FAccount FAccount::FromPrivateKey(const TArray<uint8>& PrivateKey)
 	{
 		newAccount.PublicKeyData[i] = PrivateKey[i + PublicKeySize];
 	}
-
-	newAccount.PublicKey = FBase58::EncodeBase58(newAccount.PublicKeyData.GetData(), newAccount.PublicKeyData.Num());
-	newAccount.PrivateKey = FBase58::EncodeBase58(newAccount.PrivateKeyData.GetData(), newAccount.PrivateKeyData.Num());
+	newAccount.Key = FPublicKey(newAccount.PublicKeyData);
+	newAccount.SigningKey = FSigningKey(newAccount.PrivateKeyData);
+	newAccount.EncodeKeyStrings();
 
 	return newAccount;
 }
@@ -93,7 +145,8 @@ FAccount FAccount::FromPublicKey(const FString& publicKey)
 {
 	FAccount newAccount;
 
-	newAccount.PublicKeyData = FBase58::DecodeBase58(publicKey);
+	newAccount.Key = FPublicKey(publicKey);
+	newAccount.PublicKeyData = newAccount.Key.ToBytes();
 	newAccount.PublicKey = publicKey;
 
 	return newAccount;
@@ -104,7 +157,8 @@ FAccount FAccount::FromPublicKey(const TArray<uint8>& publicKey)
 	FAccount newAccount;
 
 	newAccount.PublicKeyData = publicKey;
-	newAccount.PublicKey = FBase58::EncodeBase58(newAccount.PublicKeyData.GetData(), newAccount.PublicKeyData.Num());
+	newAccount.Key = FPublicKey(publicKey);
+	newAccount.PublicKey = newAccount.Key.ToBase58();
 
 	return newAccount;
 }
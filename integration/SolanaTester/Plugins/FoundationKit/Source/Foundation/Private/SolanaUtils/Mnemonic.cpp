@@ -19,14 +19,64 @@ Contributers: Daniele Calanna, Riccardo Torrisi, Federico Arona
 
 #include "SolanaUtils/Mnemonic.h"
 
-#include "SolanaUtils/Utils/Types.h"
 #include "Crypto/CryptoUtils.h"
+#include "Crypto/HashBatch.h"
 #include "SolanaUtils/Utils/HardcodedWordList.h"
 
-#include <bitset>
+constexpr int32 MinWordCount = 12;
+constexpr int32 MaxWordCount = 24;
+constexpr int32 BitsPerWord = 11;
+// Every 3 words hold 32 bits of entropy and 1 bit of checksum.
+constexpr int32 WordsPerChecksumBit = 3;
+constexpr int32 MaxEncodedSize = (MaxWordCount * BitsPerWord + 7) / 8;
 
-const int WordCount = 24;
-const int EntrophyValue = 256 / 8;
+namespace
+{
+	bool IsValidWordCount(int32 Count)
+	{
+		return Count >= MinWordCount && Count <= MaxWordCount && Count % WordsPerChecksumBit == 0;
+	}
+
+	int32 GetEntropySize(int32 WordCount)
+	{
+		return WordCount / WordsPerChecksumBit * 4;
+	}
+
+	// Reads WordCount big endian 11 bit values from the first (WordCount * 11 + 7) / 8 bytes.
+	void UnpackWordIndices(const uint8* Bytes, int32 WordCount, uint16* OutIndices)
+	{
+		uint32 Bits = 0;
+		int32 NumBits = 0;
+		for (int32 i = 0; i < WordCount; i++)
+		{
+			while (NumBits < BitsPerWord)
+			{
+				Bits = Bits << 8 | *Bytes++;
+				NumBits += 8;
+			}
+			NumBits -= BitsPerWord;
+			OutIndices[i] = static_cast<uint16>(Bits >> NumBits & (FHardcodedWordList::NumWords - 1));
+		}
+	}
+
+	// The inverse of UnpackWordIndices, the last byte is padded with zeros.
+	void PackWordIndices(const uint16* Indices, int32 WordCount, uint8* OutBytes)
+	{
+		uint32 Bits = 0;
+		int32 NumBits = 0;
+		for (int32 i = 0; i < WordCount; i++)
+		{
+			Bits = Bits << BitsPerWord | Indices[i];
+			NumBits += BitsPerWord;
+			while (NumBits >= 8)
+			{
+				NumBits -= 8;
+				*OutBytes++ = static_cast<uint8>(Bits >> NumBits);
+			}
+		}
+		if (NumBits > 0) { *OutBytes = static_cast<uint8>(Bits << (8 - NumBits)); }
+	}
+}
 
 FMnemonic::FMnemonic()
 {
@@ -50,12 +100,12 @@ FMnemonic::FMnemonic(int wordCount)
 	Mnemonic = GenerateSentence(wordCount);
 }
 
-TArray<uint8> FMnemonic::GenerateEntropy()
+TArray<uint8> FMnemonic::GenerateEntropy(int32 EntropySize)
 {
 	TArray<uint8> entropy;
-	entropy.SetNum(PublicKeySize);
+	entropy.SetNum(EntropySize);
 
-	if(!FCryptoUtils::RandomBytes(entropy, PublicKeySize))
+	if(!FCryptoUtils::RandomBytes(entropy, EntropySize))
 	{
 		//Error
 	}
@@ -68,24 +118,29 @@ TArray<uint8> FMnemonic::GenerateEntropy()
 
 FString FMnemonic::GenerateSentence(int wordCount)
 {
-	FString sentence;
-
-	TArray<uint8> entropy = GenerateEntropy();
-	TArray<uint32> indices = FCryptoUtils::SplitBytesByBits(entropy, 11);
+	if (!IsValidWordCount(wordCount))
+	{
+		UE_LOG(LogTemp, Error, TEXT("Invalid mnemonic word count %d, expected 12, 15, 18, 21 or 24"), wordCount);
+		return FString();
+	}
 
-	TArray<FString> wordList;
-	FHardcodedWordList::GetWordList().ParseIntoArray(wordList,TEXT("\n"));
+	// The checksum byte after the entropy supplies the low bits of the last word.
+	TArray<uint8> Entropy = GenerateEntropy(GetEntropySize(wordCount));
+	uint16 Indices[MaxWordCount];
+	UnpackWordIndices(Entropy.GetData(), wordCount, Indices);
 
-	for(int i = 0; i < wordCount; i++)
+	FString Sentence;
+	Sentence.Reserve(wordCount * (FHardcodedWordList::MaxWordLength + 1));
+	for (int32 i = 0; i < wordCount; i++)
 	{
-		sentence.Append(wordList[indices[i]]);
-		if( i < wordCount - 1 )
-		{
-			sentence.Append(" ");
-		}
+		if (i > 0) { Sentence.AppendChar(TEXT(' ')); }
+		const ANSICHAR* Word = FHardcodedWordList::Words[Indices[i]];
+		Sentence.Append(Word, FCStringAnsi::Strlen(Word));
 	}
 
-	return sentence;
+	FMemory::Memzero(Entropy.GetData(), Entropy.Num());
+	FMemory::Memzero(Indices, sizeof(Indices));
+	return Sentence;
 }
 
 TArray<uint8> FMnemonic::DeriveSeed() const
@@ -102,55 +157,41 @@ TArray<uint8> FMnemonic::DeriveSeed(const FString& mnemonic)
 
 bool FMnemonic::IsMnemonic(const FString& MnemonicString)
 {
-	TArray<FString> MnemonicWords;
-	const int32 NumWords = MnemonicString.ParseIntoArrayWS(MnemonicWords, nullptr, true);
-
-	if (!(NumWords >= 12 && NumWords <= 24))
+	// Words are looked up in place, nothing is allocated.
+	uint16 Indices[MaxWordCount];
+	int32 NumWords = 0;
+	for (const TCHAR* Cursor = *MnemonicString;;)
 	{
-		return false;
-	}
+		while (FChar::IsWhitespace(*Cursor)) { Cursor++; }
+		if (*Cursor == 0) { break; }
 
-	if (NumWords % 3 != 0)
-	{
-		return false;
-	}
-
-	TArray<FString> wordList;
-	FHardcodedWordList::GetWordList().ParseIntoArray(wordList,TEXT("\n"));
-
-	const uint32 NumBits = NumWords * 11;
-	uint32 EntropyLen = NumBits / 8;
-	uint32 ChecksumNumBits = NumBits % 8;
-	if (ChecksumNumBits == 0)
-	{
-		--EntropyLen;
-		ChecksumNumBits = 8;
-	}
-
-	TArray<uint8> Entropy;
-	Entropy.SetNum(EntropyLen);
+		const TCHAR* Word = Cursor;
+		while (*Cursor != 0 && !FChar::IsWhitespace(*Cursor)) { Cursor++; }
 
-	FString BitString = FString();
-	for (const FString& MnemonicWord : MnemonicWords)
-	{
-		const int32 Index = wordList.Find(MnemonicWord);
+		const int32 Index = NumWords < MaxWordCount ? FHardcodedWordList::Find(Word, Cursor - Word) : INDEX_NONE;
 		if (Index == INDEX_NONE)
 		{
 			return false;
 		}
-		BitString += UTF8_TO_TCHAR(std::bitset<11>(Index).to_string().c_str());
+		Indices[NumWords++] = Index;
 	}
 
-	for (int32 Index = 0; Index < Entropy.Num(); ++Index)
+	if (!IsValidWordCount(NumWords))
 	{
-		const FString SubString = BitString.Mid(Index * 8, 8);
-		Entropy[Index] = std::bitset<8>(TCHAR_TO_UTF8(*SubString)).to_ulong();
+		return false;
 	}
 
-	TArray<uint8> CalculatedChecksum = FCryptoUtils::SHA256_Digest(Entropy.GetData(), Entropy.Num());
-	const FString ExpectedChecksumString = FString(UTF8_TO_TCHAR(std::bitset<8>(CalculatedChecksum[0]).to_string().c_str())).Left(ChecksumNumBits);
+	uint8 Bytes[MaxEncodedSize];
+	PackWordIndices(Indices, NumWords, Bytes);
 
-	const FString InputChecksumString = BitString.Right(ChecksumNumBits);
+	// The entropy is followed by the first NumWords / 3 bits of its hash.
+	const int32 EntropySize = GetEntropySize(NumWords);
+	const int32 ChecksumNumBits = NumWords / WordsPerChecksumBit;
+	uint8 Hash[FHashBatch::SHA256Size];
+	FHashBatch::SHA256(Bytes, EntropySize, Hash);
+	const bool bValid = (Bytes[EntropySize] ^ Hash[0]) >> (8 - ChecksumNumBits) == 0;
 
-	return InputChecksumString == ExpectedChecksumString;
+	FMemory::Memzero(Bytes, sizeof(Bytes));
+	FMemory::Memzero(Indices, sizeof(Indices));
+	return bValid;
 }
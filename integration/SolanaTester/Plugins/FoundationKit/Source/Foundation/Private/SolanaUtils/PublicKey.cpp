@@ -0,0 +1,63 @@
+/*
+Copyright 2022 ATMTA, Inc.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+	http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "SolanaUtils/PublicKey.h"
+
+#include "Crypto/Base58.h"
+
+FPublicKey::FPublicKey(const uint8* InBytes, int32 Len)
+	: FPublicKey()
+{
+	if (Len != Size)
+	{
+		UE_LOG(LogTemp, Error, TEXT("Invalid public key length: %d"), Len);
+		return;
+	}
+	FMemory::Memcpy(Bytes, InBytes, Size);
+}
+
+FPublicKey::FPublicKey(const TArray<uint8>& InBytes)
+	: FPublicKey(InBytes.GetData(), InBytes.Num())
+{
+}
+
+FPublicKey::FPublicKey(const FString& Base58)
+	: FPublicKey()
+{
+	if (!FromBase58(Base58, *this))
+	{
+		UE_LOG(LogTemp, Error, TEXT("Invalid base58 public key: %s"), *Base58);
+	}
+}
+
+bool FPublicKey::FromBase58(const FString& Base58, FPublicKey& OutKey)
+{
+	FPublicKey Key;
+	if (!FBase58::Decode32(*Base58, Base58.Len(), Key.Bytes))
+	{
+		return false;
+	}
+
+	OutKey = Key;
+	return true;
+}
+
+FString FPublicKey::ToBase58() const
+{
+	ANSICHAR Encoded[MaxBase58Size];
+	const int32 Len = FBase58::Encode32(Bytes, Encoded);
+	return FString(Len, Encoded);
+}
@@ -19,11 +19,318 @@ Author: Jon Sawler
 
 #include "CoreMinimal.h"
 
+/**
+ * The English BIP39 word list, where a word's index is the 11 bit value it encodes. The list is sorted, so Find() is
+ * a binary search over the table and nothing is built at runtime.
+ */
 class FHardcodedWordList
 {
 public:
-	static FString GetWordList()
+	static constexpr int32 NumWords = 2048;
+	static constexpr int32 MaxWordLength = 8;
+
+	static constexpr const ANSICHAR* Words[NumWords] = {
+		"abandon", "ability", "able", "about", "above", "absent", "absorb", "abstract",
+		"absurd", "abuse", "access", "accident", "account", "accuse", "achieve", "acid",
+		"acoustic", "acquire", "across", "act", "action", "actor", "actress", "actual",
+		"adapt", "add", "addict", "address", "adjust", "admit", "adult", "advance",
+		"advice", "aerobic", "affair", "afford", "afraid", "again", "age", "agent",
+		"agree", "ahead", "aim", "air", "airport", "aisle", "alarm", "album",
+		"alcohol", "alert", "alien", "all", "alley", "allow", "almost", "alone",
+		"alpha", "already", "also", "alter", "always", "amateur", "amazing", "among",
+		"amount", "amused", "analyst", "anchor", "ancient", "anger", "angle", "angry",
+		"animal", "ankle", "announce", "annual", "another", "answer", "antenna", "antique",
+		"anxiety", "any", "apart", "apology", "appear", "apple", "approve", "april",
+		"arch", "arctic", "area", "arena", "argue", "arm", "armed", "armor",
+		"army", "around", "arrange", "arrest", "arrive", "arrow", "art", "artefact",
+		"artist", "artwork", "ask", "aspect", "assault", "asset", "assist", "assume",
+		"asthma", "athlete", "atom", "attack", "attend", "attitude", "attract", "auction",
+		"audit", "august", "aunt", "author", "auto", "autumn", "average", "avocado",
+		"avoid", "awake", "aware", "away", "awesome", "awful", "awkward", "axis",
+		"baby", "bachelor", "bacon", "badge", "bag", "balance", "balcony", "ball",
+		"bamboo", "banana", "banner", "bar", "barely", "bargain", "barrel", "base",
+		"basic", "basket", "battle", "beach", "bean", "beauty", "because", "become",
+		"beef", "before", "begin", "behave", "behind", "believe", "below", "belt",
+		"bench", "benefit", "best", "betray", "better", "between", "beyond", "bicycle",
+		"bid", "bike", "bind", "biology", "bird", "birth", "bitter", "black",
+		"blade", "blame", "blanket", "blast", "bleak", "bless", "blind", "blood",
+		"blossom", "blouse", "blue", "blur", "blush", "board", "boat", "body",
+		"boil", "bomb", "bone", "bonus", "book", "boost", "border", "boring",
+		"borrow", "boss", "bottom", "bounce", "box", "boy", "bracket", "brain",
+		"brand", "brass", "brave", "bread", "breeze", "brick", "bridge", "brief",
+		"bright", "bring", "brisk", "broccoli", "broken", "bronze", "broom", "brother",
+		"brown", "brush", "bubble", "buddy", "budget", "buffalo", "build", "bulb",
+		"bulk", "bullet", "bundle", "bunker", "burden", "burger", "burst", "bus",
+		"business", "busy", "butter", "buyer", "buzz", "cabbage", "cabin", "cable",
+		"cactus", "cage", "cake", "call", "calm", "camera", "camp", "can",
+		"canal", "cancel", "candy", "cannon", "canoe", "canvas", "canyon", "capable",
+		"capital", "captain", "car", "carbon", "card", "cargo", "carpet", "carry",
+		"cart", "case", "cash", "casino", "castle", "casual", "cat", "catalog",
+		"catch", "category", "cattle", "caught", "cause", "caution", "cave", "ceiling",
+		"celery", "cement", "census", "century", "cereal", "certain", "chair", "chalk",
+		"champion", "change", "chaos", "chapter", "charge", "chase", "chat", "cheap",
+		"check", "cheese", "chef", "cherry", "chest", "chicken", "chief", "child",
+		"chimney", "choice", "choose", "chronic", "chuckle", "chunk", "churn", "cigar",
+		"cinnamon", "circle", "citizen", "city", "civil", "claim", "clap", "clarify",
+		"claw", "clay", "clean", "clerk", "clever", "click", "client", "cliff",
+		"climb", "clinic", "clip", "clock", "clog", "close", "cloth", "cloud",
+		"clown", "club", "clump", "cluster", "clutch", "coach", "coast", "coconut",
+		"code", "coffee", "coil", "coin", "collect", "color", "column", "combine",
+		"come", "comfort", "comic", "common", "company", "concert", "conduct", "confirm",
+		"congress", "connect", "consider", "control", "convince", "cook", "cool", "copper",
+		"copy", "coral", "core", "corn", "correct", "cost", "cotton", "couch",
+		"country", "couple", "course", "cousin", "cover", "coyote", "crack", "cradle",
+		"craft", "cram", "crane", "crash", "crater", "crawl", "crazy", "cream",
+		"credit", "creek", "crew", "cricket", "crime", "crisp", "critic", "crop",
+		"cross", "crouch", "crowd", "crucial", "cruel", "cruise", "crumble", "crunch",
+		"crush", "cry", "crystal", "cube", "culture", "cup", "cupboard", "curious",
+		"current", "curtain", "curve", "cushion", "custom", "cute", "cycle", "dad",
+		"damage", "damp", "dance", "danger", "daring", "dash", "daughter", "dawn",
+		"day", "deal", "debate", "debris", "decade", "december", "decide", "decline",
+		"decorate", "decrease", "deer", "defense", "define", "defy", "degree", "delay",
+		"deliver", "demand", "demise", "denial", "dentist", "deny", "depart", "depend",
+		"deposit", "depth", "deputy", "derive", "describe", "desert", "design", "desk",
+		"despair", "destroy", "detail", "detect", "develop", "device", "devote", "diagram",
+		"dial", "diamond", "diary", "dice", "diesel", "diet", "differ", "digital",
+		"dignity", "dilemma", "dinner", "dinosaur", "direct", "dirt", "disagree", "discover",
+		"disease", "dish", "dismiss", "disorder", "display", "distance", "divert", "divide",
+		"divorce", "dizzy", "doctor", "document", "dog", "doll", "dolphin", "domain",
+		"donate", "donkey", "donor", "door", "dose", "double", "dove", "draft",
+		"dragon", "drama", "drastic", "draw", "dream", "dress", "drift", "drill",
+		"drink", "drip", "drive", "drop", "drum", "dry", "duck", "dumb",
+		"dune", "during", "dust", "dutch", "duty", "dwarf", "dynamic", "eager",
+		"eagle", "early", "earn", "earth", "easily", "east", "easy", "echo",
+		"ecology", "economy", "edge", "edit", "educate", "effort", "egg", "eight",
+		"either", "elbow", "elder", "electric", "elegant", "element", "elephant", "elevator",
+		"elite", "else", "embark", "embody", "embrace", "emerge", "emotion", "employ",
+		"empower", "empty", "enable", "enact", "end", "endless", "endorse", "enemy",
+		"energy", "enforce", "engage", "engine", "enhance", "enjoy", "enlist", "enough",
+		"enrich", "enroll", "ensure", "enter", "entire", "entry", "envelope", "episode",
+		"equal", "equip", "era", "erase", "erode", "erosion", "error", "erupt",
+		"escape", "essay", "essence", "estate", "eternal", "ethics", "evidence", "evil",
+		"evoke", "evolve", "exact", "example", "excess", "exchange", "excite", "exclude",
+		"excuse", "execute", "exercise", "exhaust", "exhibit", "exile", "exist", "exit",
+		"exotic", "expand", "expect", "expire", "explain", "expose", "express", "extend",
+		"extra", "eye", "eyebrow", "fabric", "face", "faculty", "fade", "faint",
+		"faith", "fall", "false", "fame", "family", "famous", "fan", "fancy",
+		"fantasy", "farm", "fashion", "fat", "fatal", "father", "fatigue", "fault",
+		"favorite", "feature", "february", "federal", "fee", "feed", "feel", "female",
+		"fence", "festival", "fetch", "fever", "few", "fiber", "fiction", "field",
+		"figure", "file", "film", "filter", "final", "find", "fine", "finger",
+		"finish", "fire", "firm", "first", "fiscal", "fish", "fit", "fitness",
+		"fix", "flag", "flame", "flash", "flat", "flavor", "flee", "flight",
+		"flip", "float", "flock", "floor", "flower", "fluid", "flush", "fly",
+		"foam", "focus", "fog", "foil", "fold", "follow", "food", "foot",
+		"force", "forest", "forget", "fork", "fortune", "forum", "forward", "fossil",
+		"foster", "found", "fox", "fragile", "frame", "frequent", "fresh", "friend",
+		"fringe", "frog", "front", "frost", "frown", "frozen", "fruit", "fuel",
+		"fun", "funny", "furnace", "fury", "future", "gadget", "gain", "galaxy",
+		"gallery", "game", "gap", "garage", "garbage", "garden", "garlic", "garment",
+		"gas", "gasp", "gate", "gather", "gauge", "gaze", "general", "genius",
+		"genre", "gentle", "genuine", "gesture", "ghost", "giant", "gift", "giggle",
+		"ginger", "giraffe", "girl", "give", "glad", "glance", "glare", "glass",
+		"glide", "glimpse", "globe", "gloom", "glory", "glove", "glow", "glue",
+		"goat", "goddess", "gold", "good", "goose", "gorilla", "gospel", "gossip",
+		"govern", "gown", "grab", "grace", "grain", "grant", "grape", "grass",
+		"gravity", "great", "green", "grid", "grief", "grit", "grocery", "group",
+		"grow", "grunt", "guard", "guess", "guide", "guilt", "guitar", "gun",
+		"gym", "habit", "hair", "half", "hammer", "hamster", "hand", "happy",
+		"harbor", "hard", "harsh", "harvest", "hat", "have", "hawk", "hazard",
+		"head", "health", "heart", "heavy", "hedgehog", "height", "hello", "helmet",
+		"help", "hen", "hero", "hidden", "high", "hill", "hint", "hip",
+		"hire", "history", "hobby", "hockey", "hold", "hole", "holiday", "hollow",
+		"home", "honey", "hood", "hope", "horn", "horror", "horse", "hospital",
+		"host", "hotel", "hour", "hover", "hub", "huge", "human", "humble",
+		"humor", "hundred", "hungry", "hunt", "hurdle", "hurry", "hurt", "husband",
+		"hybrid", "ice", "icon", "idea", "identify", "idle", "ignore", "ill",
+		"illegal", "illness", "image", "imitate", "immense", "immune", "impact", "impose",
+		"improve", "impulse", "inch", "include", "income", "increase", "index", "indicate",
+		"indoor", "industry", "infant", "inflict", "inform", "inhale", "inherit", "initial",
+		"inject", "injury", "inmate", "inner", "innocent", "input", "inquiry", "insane",
+		"insect", "inside", "inspire", "install", "intact", "interest", "into", "invest",
+		"invite", "involve", "iron", "island", "isolate", "issue", "item", "ivory",
+		"jacket", "jaguar", "jar", "jazz", "jealous", "jeans", "jelly", "jewel",
+		"job", "join", "joke", "journey", "joy", "judge", "juice", "jump",
+		"jungle", "junior", "junk", "just", "kangaroo", "keen", "keep", "ketchup",
+		"key", "kick", "kid", "kidney", "kind", "kingdom", "kiss", "kit",
+		"kitchen", "kite", "kitten", "kiwi", "knee", "knife", "knock", "know",
+		"lab", "label", "labor", "ladder", "lady", "lake", "lamp", "language",
+		"laptop", "large", "later", "latin", "laugh", "laundry", "lava", "law",
+		"lawn", "lawsuit", "layer", "lazy", "leader", "leaf", "learn", "leave",
+		"lecture", "left", "leg", "legal", "legend", "leisure", "lemon", "lend",
+		"length", "lens", "leopard", "lesson", "letter", "level", "liar", "liberty",
+		"library", "license", "life", "lift", "light", "like", "limb", "limit",
+		"link", "lion", "liquid", "list", "little", "live", "lizard", "load",
+		"loan", "lobster", "local", "lock", "logic", "lonely", "long", "loop",
+		"lottery", "loud", "lounge", "love", "loyal", "lucky", "luggage", "lumber",
+		"lunar", "lunch", "luxury", "lyrics", "machine", "mad", "magic", "magnet",
+		"maid", "mail", "main", "major", "make", "mammal", "man", "manage",
+		"mandate", "mango", "mansion", "manual", "maple", "marble", "march", "margin",
+		"marine", "market", "marriage", "mask", "mass", "master", "match", "material",
+		"math", "matrix", "matter", "maximum", "maze", "meadow", "mean", "measure",
+		"meat", "mechanic", "medal", "media", "melody", "melt", "member", "memory",
+		"mention", "menu", "mercy", "merge", "merit", "merry", "mesh", "message",
+		"metal", "method", "middle", "midnight", "milk", "million", "mimic", "mind",
+		"minimum", "minor", "minute", "miracle", "mirror", "misery", "miss", "mistake",
+		"mix", "mixed", "mixture", "mobile", "model", "modify", "mom", "moment",
+		"monitor", "monkey", "monster", "month", "moon", "moral", "more", "morning",
+		"mosquito", "mother", "motion", "motor", "mountain", "mouse", "move", "movie",
+		"much", "muffin", "mule", "multiply", "muscle", "museum", "mushroom", "music",
+		"must", "mutual", "myself", "mystery", "myth", "naive", "name", "napkin",
+		"narrow", "nasty", "nation", "nature", "near", "neck", "need", "negative",
+		"neglect", "neither", "nephew", "nerve", "nest", "net", "network", "neutral",
+		"never", "news", "next", "nice", "night", "noble", "noise", "nominee",
+		"noodle", "normal", "north", "nose", "notable", "note", "nothing", "notice",
+		"novel", "now", "nuclear", "number", "nurse", "nut", "oak", "obey",
+		"object", "oblige", "obscure", "observe", "obtain", "obvious", "occur", "ocean",
+		"october", "odor", "off", "offer", "office", "often", "oil", "okay",
+		"old", "olive", "olympic", "omit", "once", "one", "onion", "online",
+		"only", "open", "opera", "opinion", "oppose", "option", "orange", "orbit",
+		"orchard", "order", "ordinary", "organ", "orient", "original", "orphan", "ostrich",
+		"other", "outdoor", "outer", "output", "outside", "oval", "oven", "over",
+		"own", "owner", "oxygen", "oyster", "ozone", "pact", "paddle", "page",
+		"pair", "palace", "palm", "panda", "panel", "panic", "panther", "paper",
+		"parade", "parent", "park", "parrot", "party", "pass", "patch", "path",
+		"patient", "patrol", "pattern", "pause", "pave", "payment", "peace", "peanut",
+		"pear", "peasant", "pelican", "pen", "penalty", "pencil", "people", "pepper",
+		"perfect", "permit", "person", "pet", "phone", "photo", "phrase", "physical",
+		"piano", "picnic", "picture", "piece", "pig", "pigeon", "pill", "pilot",
+		"pink", "pioneer", "pipe", "pistol", "pitch", "pizza", "place", "planet",
+		"plastic", "plate", "play", "please", "pledge", "pluck", "plug", "plunge",
+		"poem", "poet", "point", "polar", "pole", "police", "pond", "pony",
+		"pool", "popular", "portion", "position", "possible", "post", "potato", "pottery",
+		"poverty", "powder", "power", "practice", "praise", "predict", "prefer", "prepare",
+		"present", "pretty", "prevent", "price", "pride", "primary", "print", "priority",
+		"prison", "private", "prize", "problem", "process", "produce", "profit", "program",
+		"project", "promote", "proof", "property", "prosper", "protect", "proud", "provide",
+		"public", "pudding", "pull", "pulp", "pulse", "pumpkin", "punch", "pupil",
+		"puppy", "purchase", "purity", "purpose", "purse", "push", "put", "puzzle",
+		"pyramid", "quality", "quantum", "quarter", "question", "quick", "quit", "quiz",
+		"quote", "rabbit", "raccoon", "race", "rack", "radar", "radio", "rail",
+		"rain", "raise", "rally", "ramp", "ranch", "random", "range", "rapid",
+		"rare", "rate", "rather", "raven", "raw", "razor", "ready", "real",
+		"reason", "rebel", "rebuild", "recall", "receive", "recipe", "record", "recycle",
+		"reduce", "reflect", "reform", "refuse", "region", "regret", "regular", "reject",
+		"relax", "release", "relief", "rely", "remain", "remember", "remind", "remove",
+		"render", "renew", "rent", "reopen", "repair", "repeat", "replace", "report",
+		"require", "rescue", "resemble", "resist", "resource", "response", "result", "retire",
+		"retreat", "return", "reunion", "reveal", "review", "reward", "rhythm", "rib",
+		"ribbon", "rice", "rich", "ride", "ridge", "rifle", "right", "rigid",
+		"ring", "riot", "ripple", "risk", "ritual", "rival", "river", "road",
+		"roast", "robot", "robust", "rocket", "romance", "roof", "rookie", "room",
+		"rose", "rotate", "rough", "round", "route", "royal", "rubber", "rude",
+		"rug", "rule", "run", "runway", "rural", "sad", "saddle", "sadness",
+		"safe", "sail", "salad", "salmon", "salon", "salt", "salute", "same",
+		"sample", "sand", "satisfy", "satoshi", "sauce", "sausage", "save", "say",
+		"scale", "scan", "scare", "scatter", "scene", "scheme", "school", "science",
+		"scissors", "scorpion", "scout", "scrap", "screen", "script", "scrub", "sea",
+		"search", "season", "seat", "second", "secret", "section", "security", "seed",
+		"seek", "segment", "select", "sell", "seminar", "senior", "sense", "sentence",
+		"series", "service", "session", "settle", "setup", "seven", "shadow", "shaft",
+		"shallow", "share", "shed", "shell", "sheriff", "shield", "shift", "shine",
+		"ship", "shiver", "shock", "shoe", "shoot", "shop", "short", "shoulder",
+		"shove", "shrimp", "shrug", "shuffle", "shy", "sibling", "sick", "side",
+		"siege", "sight", "sign", "silent", "silk", "silly", "silver", "similar",
+		"simple", "since", "sing", "siren", "sister", "situate", "six", "size",
+		"skate", "sketch", "ski", "skill", "skin", "skirt", "skull", "slab",
+		"slam", "sleep", "slender", "slice", "slide", "slight", "slim", "slogan",
+		"slot", "slow", "slush", "small", "smart", "smile", "smoke", "smooth",
+		"snack", "snake", "snap", "sniff", "snow", "soap", "soccer", "social",
+		"sock", "soda", "soft", "solar", "soldier", "solid", "solution", "solve",
+		"someone", "song", "soon", "sorry", "sort", "soul", "sound", "soup",
+		"source", "south", "space", "spare", "spatial", "spawn", "speak", "special",
+		"speed", "spell", "spend", "sphere", "spice", "spider", "spike", "spin",
+		"spirit", "split", "spoil", "sponsor", "spoon", "sport", "spot", "spray",
+		"spread", "spring", "spy", "square", "squeeze", "squirrel", "stable", "stadium",
+		"staff", "stage", "stairs", "stamp", "stand", "start", "state", "stay",
+		"steak", "steel", "stem", "step", "stereo", "stick", "still", "sting",
+		"stock", "stomach", "stone", "stool", "story", "stove", "strategy", "street",
+		"strike", "strong", "struggle", "student", "stuff", "stumble", "style", "subject",
+		"submit", "subway", "success", "such", "sudden", "suffer", "sugar", "suggest",
+		"suit", "summer", "sun", "sunny", "sunset", "super", "supply", "supreme",
+		"sure", "surface", "surge", "surprise", "surround", "survey", "suspect", "sustain",
+		"swallow", "swamp", "swap", "swarm", "swear", "sweet", "swift", "swim",
+		"swing", "switch", "sword", "symbol", "symptom", "syrup", "system", "table",
+		"tackle", "tag", "tail", "talent", "talk", "tank", "tape", "target",
+		"task", "taste", "tattoo", "taxi", "teach", "team", "tell", "ten",
+		"tenant", "tennis", "tent", "term", "test", "text", "thank", "that",
+		"theme", "then", "theory", "there", "they", "thing", "this", "thought",
+		"three", "thrive", "throw", "thumb", "thunder", "ticket", "tide", "tiger",
+		"tilt", "timber", "time", "tiny", "tip", "tired", "tissue", "title",
+		"toast", "tobacco", "today", "toddler", "toe", "together", "toilet", "token",
+		"tomato", "tomorrow", "tone", "tongue", "tonight", "tool", "tooth", "top",
+		"topic", "topple", "torch", "tornado", "tortoise", "toss", "total", "tourist",
+		"toward", "tower", "town", "toy", "track", "trade", "traffic", "tragic",
+		"train", "transfer", "trap", "trash", "travel", "tray", "treat", "tree",
+		"trend", "trial", "tribe", "trick", "trigger", "trim", "trip", "trophy",
+		"trouble", "truck", "true", "truly", "trumpet", "trust", "truth", "try",
+		"tube", "tuition", "tumble", "tuna", "tunnel", "turkey", "turn", "turtle",
+		"twelve", "twenty", "twice", "twin", "twist", "two", "type", "typical",
+		"ugly", "umbrella", "unable", "unaware", "uncle", "uncover", "under", "undo",
+		"unfair", "unfold", "unhappy", "uniform", "unique", "unit", "universe", "unknown",
+		"unlock", "until", "unusual", "unveil", "update", "upgrade", "uphold", "upon",
+		"upper", "upset", "urban", "urge", "usage", "use", "used", "useful",
+		"useless", "usual", "utility", "vacant", "vacuum", "vague", "valid", "valley",
+		"valve", "van", "vanish", "vapor", "various", "vast", "vault", "vehicle",
+		"velvet", "vendor", "venture", "venue", "verb", "verify", "version", "very",
+		"vessel", "veteran", "viable", "vibrant", "vicious", "victory", "video", "view",
+		"village", "vintage", "violin", "virtual", "virus", "visa", "visit", "visual",
+		"vital", "vivid", "vocal", "voice", "void", "volcano", "volume", "vote",
+		"voyage", "wage", "wagon", "wait", "walk", "wall", "walnut", "want",
+		"warfare", "warm", "warrior", "wash", "wasp", "waste", "water", "wave",
+		"way", "wealth", "weapon", "wear", "weasel", "weather", "web", "wedding",
+		"weekend", "weird", "welcome", "west", "wet", "whale", "what", "wheat",
+		"wheel", "when", "where", "whip", "whisper", "wide", "width", "wife",
+		"wild", "will", "win", "window", "wine", "wing", "wink", "winner",
+		"winter", "wire", "wisdom", "wise", "wish", "witness", "wolf", "woman",
+		"wonder", "wood", "wool", "word", "work", "world", "worry", "worth",
+		"wrap", "wreck", "wrestle", "wrist", "write", "wrong", "yard", "year",
+		"yellow", "you", "young", "youth", "zebra", "zero", "zone", "zoo",
+	};
+
+	// Index of the Length characters at Word, ignoring case. INDEX_NONE if they are not a word of the list.
+	static int32 Find(const TCHAR* Word, int32 Length)
+	{
+		if (Length <= 0 || Length > MaxWordLength) { return INDEX_NONE; }
+
+		int32 Low = 0;
+		int32 High = NumWords;
+		while (Low < High)
+		{
+			const int32 Middle = (Low + High) / 2;
+			const int32 Order = Compare(Word, Length, Words[Middle]);
+			if (Order == 0) { return Middle; }
+			if (Order < 0) { High = Middle; }
+			else { Low = Middle + 1; }
+		}
+		return INDEX_NONE;
+	}
+
+private:
+	static int32 Compare(const TCHAR* Word, int32 Length, const ANSICHAR* ListWord)
+	{
+		for (int32 i = 0; i < Length; i++)
+		{
+			// A list word that is a prefix of Word sorts first.
+			if (ListWord[i] == 0) { return 1; }
+
+			const int32 Char = FChar::ToLower(Word[i]);
+			const int32 ListChar = static_cast<uint8>(ListWord[i]);
+			if (Char != ListChar) { return Char < ListChar ? -1 : 1; }
+		}
+		return ListWord[Length] == 0 ? 0 : -1;
+	}
+};
+
+static_assert([]
+{
+	for (int32 i = 1; i < FHardcodedWordList::NumWords; i++)
 	{
-		return FString("abandon\nability\nable\nabout\nabove\nabsent\nabsorb\nabstract\nabsurd\nabuse\naccess\naccident\naccount\naccuse\nachieve\nacid\nacoustic\nacquire\nacross\nact\naction\nactor\nactress\nactual\nadapt\nadd\naddict\naddress\nadjust\nadmit\nadult\nadvance\nadvice\naerobic\naffair\nafford\nafraid\nagain\nage\nagent\nagree\nahead\naim\nair\nairport\naisle\nalarm\nalbum\nalcohol\nalert\nalien\nall\nalley\nallow\nalmost\nalone\nalpha\nalready\nalso\nalter\nalways\namateur\namazing\namong\namount\namused\nanalyst\nanchor\nancient\nanger\nangle\nangry\nanimal\nankle\nannounce\nannual\nanother\nanswer\nantenna\nantique\nanxiety\nany\napart\napology\nappear\napple\napprove\napril\narch\narctic\narea\narena\nargue\narm\narmed\narmor\narmy\naround\narrange\narrest\narrive\narrow\nart\nartefact\nartist\nartwork\nask\naspect\nassault\nasset\nassist\nassume\nasthma\nathlete\natom\nattack\nattend\nattitude\nattract\nauction\naudit\naugust\naunt\nauthor\nauto\nautumn\naverage\navocado\navoid\nawake\naware\naway\nawesome\nawful\nawkward\naxis\nbaby\nbachelor\nbacon\nbadge\nbag\nbalance\nbalcony\nball\nbamboo\nbanana\nbanner\nbar\nbarely\nbargain\nbarrel\nbase\nbasic\nbasket\nbattle\nbeach\nbean\nbeauty\nbecause\nbecome\nbeef\nbefore\nbegin\nbehave\nbehind\nbelieve\nbelow\nbelt\nbench\nbenefit\nbest\nbetray\nbetter\nbetween\nbeyond\nbicycle\nbid\nbike\nbind\nbiology\nbird\nbirth\nbitter\nblack\nblade\nblame\nblanket\nblast\nbleak\nbless\nblind\nblood\nblossom\nblouse\nblue\nblur\nblush\nboard\nboat\nbody\nboil\nbomb\nbone\nbonus\nbook\nboost\nborder\nboring\nborrow\nboss\nbottom\nbounce\nbox\nboy\nbracket\nbrain\nbrand\nbrass\nbrave\nbread\nbreeze\nbrick\nbridge\nbrief\nbright\nbring\nbrisk\nbroccoli\nbroken\nbronze\nbroom\nbrother\nbrown\nbrush\nbubble\nbuddy\nbudget\nbuffalo\nbuild\nbulb\nbulk\nbullet\nbundle\nbunker\nburden\nburger\nburst\nbus\nbusiness\nbusy\nbutter\nbuyer\nbuzz\ncabbage\ncabin\ncable\ncactus\ncage\ncake\ncall\ncalm\ncamera\ncamp\ncan\ncanal\ncancel\ncandy\ncannon\ncanoe\ncanvas\ncanyon\ncapable\ncapital\ncaptain\ncar\ncarbon\ncard\ncargo\ncarpet\ncarry\ncart\ncase\ncash\ncasino\ncastle\ncasual\ncat\ncatalog\ncatch\ncategory\ncattle\ncaught\ncause\ncaution\ncave\nceiling\ncelery\ncement\ncensus\ncentury\ncereal\ncertain\nchair\nchalk\nchampion\nchange\nchaos\nchapter\ncharge\nchase\nchat\ncheap\ncheck\ncheese\nchef\ncherry\nchest\nchicken\nchief\nchild\nchimney\nchoice\nchoose\nchronic\nchuckle\nchunk\nchurn\ncigar\ncinnamon\ncircle\ncitizen\ncity\ncivil\nclaim\nclap\nclarify\nclaw\nclay\nclean\nclerk\nclever\nclick\nclient\ncliff\nclimb\nclinic\nclip\nclock\nclog\nclose\ncloth\ncloud\nclown\nclub\nclump\ncluster\nclutch\ncoach\ncoast\ncoconut\ncode\ncoffee\ncoil\ncoin\ncollect\ncolor\ncolumn\ncombine\ncome\ncomfort\ncomic\ncommon\ncompany\nconcert\nconduct\nconfirm\ncongress\nconnect\nconsider\ncontrol\nconvince\ncook\ncool\ncopper\ncopy\ncoral\ncore\ncorn\ncorrect\ncost\ncotton\ncouch\ncountry\ncouple\ncourse\ncousin\ncover\ncoyote\ncrack\ncradle\ncraft\ncram\ncrane\ncrash\ncrater\ncrawl\ncrazy\ncream\ncredit\ncreek\ncrew\ncricket\ncrime\ncrisp\ncritic\ncrop\ncross\ncrouch\ncrowd\ncrucial\ncruel\ncruise\ncrumble\ncrunch\ncrush\ncry\ncrystal\ncube\nculture\ncup\ncupboard\ncurious\ncurrent\ncurtain\ncurve\ncushion\ncustom\ncute\ncycle\ndad\ndamage\ndamp\ndance\ndanger\ndaring\ndash\ndaughter\ndawn\nday\ndeal\ndebate\ndebris\ndecade\ndecember\ndecide\ndecline\ndecorate\ndecrease\ndeer\ndefense\ndefine\ndefy\ndegree\ndelay\ndeliver\ndemand\ndemise\ndenial\ndentist\ndeny\ndepart\ndepend\ndeposit\ndepth\ndeputy\nderive\ndescribe\ndesert\ndesign\ndesk\ndespair\ndestroy\ndetail\ndetect\ndevelop\ndevice\ndevote\ndiagram\ndial\ndiamond\ndiary\ndice\ndiesel\ndiet\ndiffer\ndigital\ndignity\ndilemma\ndinner\ndinosaur\ndirect\ndirt\ndisagree\ndiscover\ndisease\ndish\ndismiss\ndisorder\ndisplay\ndistance\ndivert\ndivide\ndivorce\ndizzy\ndoctor\ndocument\ndog\ndoll\ndolphin\ndomain\ndonate\ndonkey\ndonor\ndoor\ndose\ndouble\ndove\ndraft\ndragon\ndrama\ndrastic\ndraw\ndream\ndress\ndrift\ndrill\ndrink\ndrip\ndrive\ndrop\ndrum\ndry\nduck\ndumb\ndune\nduring\ndust\ndutch\nduty\ndwarf\ndynamic\neager\neagle\nearly\nearn\nearth\neasily\neast\neasy\necho\necology\neconomy\nedge\nedit\neducate\neffort\negg\neight\neither\nelbow\nelder\nelectric\nelegant\nelement\nelephant\nelevator\nelite\nelse\nembark\nembody\nembrace\nemerge\nemotion\nemploy\nempower\nempty\nenable\nenact\nend\nendless\nendorse\nenemy\nenergy\nenforce\nengage\nengine\nenhance\nenjoy\nenlist\nenough\nenrich\nenroll\nensure\nenter\nentire\nentry\nenvelope\nepisode\nequal\nequip\nera\nerase\nerode\nerosion\nerror\nerupt\nescape\nessay\nessence\nestate\neternal\nethics\nevidence\nevil\nevoke\nevolve\nexact\nexample\nexcess\nexchange\nexcite\nexclude\nexcuse\nexecute\nexercise\nexhaust\nexhibit\nexile\nexist\nexit\nexotic\nexpand\nexpect\nexpire\nexplain\nexpose\nexpress\nextend\nextra\neye\neyebrow\nfabric\nface\nfaculty\nfade\nfaint\nfaith\nfall\nfalse\nfame\nfamily\nfamous\nfan\nfancy\nfantasy\nfarm\nfashion\nfat\nfatal\nfather\nfatigue\nfault\nfavorite\nfeature\nfebruary\nfederal\nfee\nfeed\nfeel\nfemale\nfence\nfestival\nfetch\nfever\nfew\nfiber\nfiction\nfield\nfigure\nfile\nfilm\nfilter\nfinal\nfind\nfine\nfinger\nfinish\nfire\nfirm\nfirst\nfiscal\nfish\nfit\nfitness\nfix\nflag\nflame\nflash\nflat\nflavor\nflee\nflight\nflip\nfloat\nflock\nfloor\nflower\nfluid\nflush\nfly\nfoam\nfocus\nfog\nfoil\nfold\nfollow\nfood\nfoot\nforce\nforest\nforget\nfork\nfortune\nforum\nforward\nfossil\nfoster\nfound\nfox\nfragile\nframe\nfrequent\nfresh\nfriend\nfringe\nfrog\nfront\nfrost\nfrown\nfrozen\nfruit\nfuel\nfun\nfunny\nfurnace\nfury\nfuture\ngadget\ngain\ngalaxy\ngallery\ngame\ngap\ngarage\ngarbage\ngarden\ngarlic\ngarment\ngas\ngasp\ngate\ngather\ngauge\ngaze\ngeneral\ngenius\ngenre\ngentle\ngenuine\ngesture\nghost\ngiant\ngift\ngiggle\nginger\ngiraffe\ngirl\ngive\nglad\nglance\nglare\nglass\nglide\nglimpse\nglobe\ngloom\nglory\nglove\nglow\nglue\ngoat\ngoddess\ngold\ngood\ngoose\ngorilla\ngospel\ngossip\ngovern\ngown\ngrab\ngrace\ngrain\ngrant\ngrape\ngrass\ngravity\ngreat\ngreen\ngrid\ngrief\ngrit\ngrocery\ngroup\ngrow\ngrunt\nguard\nguess\nguide\nguilt\nguitar\ngun\ngym\nhabit\nhair\nhalf\nhammer\nhamster\nhand\nhappy\nharbor\nhard\nharsh\nharvest\nhat\nhave\nhawk\nhazard\nhead\nhealth\nheart\nheavy\nhedgehog\nheight\nhello\nhelmet\nhelp\nhen\nhero\nhidden\nhigh\nhill\nhint\nhip\nhire\nhistory\nhobby\nhockey\nhold\nhole\nholiday\nhollow\nhome\nhoney\nhood\nhope\nhorn\nhorror\nhorse\nhospital\nhost\nhotel\nhour\nhover\nhub\nhuge\nhuman\nhumble\nhumor\nhundred\nhungry\nhunt\nhurdle\nhurry\nhurt\nhusband\nhybrid\nice\nicon\nidea\nidentify\nidle\nignore\nill\nillegal\nillness\nimage\nimitate\nimmense\nimmune\nimpact\nimpose\nimprove\nimpulse\ninch\ninclude\nincome\nincrease\nindex\nindicate\nindoor\nindustry\ninfant\ninflict\ninform\ninhale\ninherit\ninitial\ninject\ninjury\ninmate\ninner\ninnocent\ninput\ninquiry\ninsane\ninsect\ninside\ninspire\ninstall\nintact\ninterest\ninto\ninvest\ninvite\ninvolve\niron\nisland\nisolate\nissue\nitem\nivory\njacket\njaguar\njar\njazz\njealous\njeans\njelly\njewel\njob\njoin\njoke\njourney\njoy\njudge\njuice\njump\njungle\njunior\njunk\njust\nkangaroo\nkeen\nkeep\nketchup\nkey\nkick\nkid\nkidney\nkind\nkingdom\nkiss\nkit\nkitchen\nkite\nkitten\nkiwi\nknee\nknife\nknock\nknow\nlab\nlabel\nlabor\nladder\nlady\nlake\nlamp\nlanguage\nlaptop\nlarge\nlater\nlatin\nlaugh\nlaundry\nlava\nlaw\nlawn\nlawsuit\nlayer\nlazy\nleader\nleaf\nlearn\nleave\nlecture\nleft\nleg\nlegal\nlegend\nleisure\nlemon\nlend\nlength\nlens\nleopard\nlesson\nletter\nlevel\nliar\nliberty\nlibrary\nlicense\nlife\nlift\nlight\nlike\nlimb\nlimit\nlink\nlion\nliquid\nlist\nlittle\nlive\nlizard\nload\nloan\nlobster\nlocal\nlock\nlogic\nlonely\nlong\nloop\nlottery\nloud\nlounge\nlove\nloyal\nlucky\nluggage\nlumber\nlunar\nlunch\nluxury\nlyrics\nmachine\nmad\nmagic\nmagnet\nmaid\nmail\nmain\nmajor\nmake\nmammal\nman\nmanage\nmandate\nmango\nmansion\nmanual\nmaple\nmarble\nmarch\nmargin\nmarine\nmarket\nmarriage\nmask\nmass\nmaster\nmatch\nmaterial\nmath\nmatrix\nmatter\nmaximum\nmaze\nmeadow\nmean\nmeasure\nmeat\nmechanic\nmedal\nmedia\nmelody\nmelt\nmember\nmemory\nmention\nmenu\nmercy\nmerge\nmerit\nmerry\nmesh\nmessage\nmetal\nmethod\nmiddle\nmidnight\nmilk\nmillion\nmimic\nmind\nminimum\nminor\nminute\nmiracle\nmirror\nmisery\nmiss\nmistake\nmix\nmixed\nmixture\nmobile\nmodel\nmodify\nmom\nmoment\nmonitor\nmonkey\nmonster\nmonth\nmoon\nmoral\nmore\nmorning\nmosquito\nmother\nmotion\nmotor\nmountain\nmouse\nmove\nmovie\nmuch\nmuffin\nmule\nmultiply\nmuscle\nmuseum\nmushroom\nmusic\nmust\nmutual\nmyself\nmystery\nmyth\nnaive\nname\nnapkin\nnarrow\nnasty\nnation\nnature\nnear\nneck\nneed\nnegative\nneglect\nneither\nnephew\nnerve\nnest\nnet\nnetwork\nneutral\nnever\nnews\nnext\nnice\nnight\nnoble\nnoise\nnominee\nnoodle\nnormal\nnorth\nnose\nnotable\nnote\nnothing\nnotice\nnovel\nnow\nnuclear\nnumber\nnurse\nnut\noak\nobey\nobject\noblige\nobscure\nobserve\nobtain\nobvious\noccur\nocean\noctober\nodor\noff\noffer\noffice\noften\noil\nokay\nold\nolive\nolympic\nomit\nonce\none\nonion\nonline\nonly\nopen\nopera\nopinion\noppose\noption\norange\norbit\norchard\norder\nordinary\norgan\norient\noriginal\norphan\nostrich\nother\noutdoor\nouter\noutput\noutside\noval\noven\nover\nown\nowner\noxygen\noyster\nozone\npact\npaddle\npage\npair\npalace\npalm\npanda\npanel\npanic\npanther\npaper\nparade\nparent\npark\nparrot\nparty\npass\npatch\npath\npatient\npatrol\npattern\npause\npave\npayment\npeace\npeanut\npear\npeasant\npelican\npen\npenalty\npencil\npeople\npepper\nperfect\npermit\nperson\npet\nphone\nphoto\nphrase\nphysical\npiano\npicnic\npicture\npiece\npig\npigeon\npill\npilot\npink\npioneer\npipe\npistol\npitch\npizza\nplace\nplanet\nplastic\nplate\nplay\nplease\npledge\npluck\nplug\nplunge\npoem\npoet\npoint\npolar\npole\npolice\npond\npony\npool\npopular\nportion\nposition\npossible\npost\npotato\npottery\npoverty\npowder\npower\npractice\npraise\npredict\nprefer\nprepare\npresent\npretty\nprevent\nprice\npride\nprimary\nprint\npriority\nprison\nprivate\nprize\nproblem\nprocess\nproduce\nprofit\nprogram\nproject\npromote\nproof\nproperty\nprosper\nprotect\nproud\nprovide\npublic\npudding\npull\npulp\npulse\npumpkin\npunch\npupil\npuppy\npurchase\npurity\npurpose\npurse\npush\nput\npuzzle\npyramid\nquality\nquantum\nquarter\nquestion\nquick\nquit\nquiz\nquote\nrabbit\nraccoon\nrace\nrack\nradar\nradio\nrail\nrain\nraise\nrally\nramp\nranch\nrandom\nrange\nrapid\nrare\nrate\nrather\nraven\nraw\nrazor\nready\nreal\nreason\nrebel\nrebuild\nrecall\nreceive\nrecipe\nrecord\nrecycle\nreduce\nreflect\nreform\nrefuse\nregion\nregret\nregular\nreject\nrelax\nrelease\nrelief\nrely\nremain\nremember\nremind\nremove\nrender\nrenew\nrent\nreopen\nrepair\nrepeat\nreplace\nreport\nrequire\nrescue\nresemble\nresist\nresource\nresponse\nresult\nretire\nretreat\nreturn\nreunion\nreveal\nreview\nreward\nrhythm\nrib\nribbon\nrice\nrich\nride\nridge\nrifle\nright\nrigid\nring\nriot\nripple\nrisk\nritual\nrival\nriver\nroad\nroast\nrobot\nrobust\nrocket\nromance\nroof\nrookie\nroom\nrose\nrotate\nrough\nround\nroute\nroyal\nrubber\nrude\nrug\nrule\nrun\nrunway\nrural\nsad\nsaddle\nsadness\nsafe\nsail\nsalad\nsalmon\nsalon\nsalt\nsalute\nsame\nsample\nsand\nsatisfy\nsatoshi\nsauce\nsausage\nsave\nsay\nscale\nscan\nscare\nscatter\nscene\nscheme\nschool\nscience\nscissors\nscorpion\nscout\nscrap\nscreen\nscript\nscrub\nsea\nsearch\nseason\nseat\nsecond\nsecret\nsection\nsecurity\nseed\nseek\nsegment\nselect\nsell\nseminar\nsenior\nsense\nsentence\nseries\nservice\nsession\nsettle\nsetup\nseven\nshadow\nshaft\nshallow\nshare\nshed\nshell\nsheriff\nshield\nshift\nshine\nship\nshiver\nshock\nshoe\nshoot\nshop\nshort\nshoulder\nshove\nshrimp\nshrug\nshuffle\nshy\nsibling\nsick\nside\nsiege\nsight\nsign\nsilent\nsilk\nsilly\nsilver\nsimilar\nsimple\nsince\nsing\nsiren\nsister\nsituate\nsix\nsize\nskate\nsketch\nski\nskill\nskin\nskirt\nskull\nslab\nslam\nsleep\nslender\nslice\nslide\nslight\nslim\nslogan\nslot\nslow\nslush\nsmall\nsmart\nsmile\nsmoke\nsmooth\nsnack\nsnake\nsnap\nsniff\nsnow\nsoap\nsoccer\nsocial\nsock\nsoda\nsoft\nsolar\nsoldier\nsolid\nsolution\nsolve\nsomeone\nsong\nsoon\nsorry\nsort\nsoul\nsound\nsoup\nsource\nsouth\nspace\nspare\nspatial\nspawn\nspeak\nspecial\nspeed\nspell\nspend\nsphere\nspice\nspider\nspike\nspin\nspirit\nsplit\nspoil\nsponsor\nspoon\nsport\nspot\nspray\nspread\nspring\nspy\nsquare\nsqueeze\nsquirrel\nstable\nstadium\nstaff\nstage\nstairs\nstamp\nstand\nstart\nstate\nstay\nsteak\nsteel\nstem\nstep\nstereo\nstick\nstill\nsting\nstock\nstomach\nstone\nstool\nstory\nstove\nstrategy\nstreet\nstrike\nstrong\nstruggle\nstudent\nstuff\nstumble\nstyle\nsubject\nsubmit\nsubway\nsuccess\nsuch\nsudden\nsuffer\nsugar\nsuggest\nsuit\nsummer\nsun\nsunny\nsunset\nsuper\nsupply\nsupreme\nsure\nsurface\nsurge\nsurprise\nsurround\nsurvey\nsuspect\nsustain\nswallow\nswamp\nswap\nswarm\nswear\nsweet\nswift\nswim\nswing\nswitch\nsword\nsymbol\nsymptom\nsyrup\nsystem\ntable\ntackle\ntag\ntail\ntalent\ntalk\ntank\ntape\ntarget\ntask\ntaste\ntattoo\ntaxi\nteach\nteam\ntell\nten\ntenant\ntennis\ntent\nterm\ntest\ntext\nthank\nthat\ntheme\nthen\ntheory\nthere\nthey\nthing\nthis\nthought\nthree\nthrive\nthrow\nthumb\nthunder\nticket\ntide\ntiger\ntilt\ntimber\ntime\ntiny\ntip\ntired\ntissue\ntitle\ntoast\ntobacco\ntoday\ntoddler\ntoe\ntogether\ntoilet\ntoken\ntomato\ntomorrow\ntone\ntongue\ntonight\ntool\ntooth\ntop\ntopic\ntopple\ntorch\ntornado\ntortoise\ntoss\ntotal\ntourist\ntoward\ntower\ntown\ntoy\ntrack\ntrade\ntraffic\ntragic\ntrain\ntransfer\ntrap\ntrash\ntravel\ntray\ntreat\ntree\ntrend\ntrial\ntribe\ntrick\ntrigger\ntrim\ntrip\ntrophy\ntrouble\ntruck\ntrue\ntruly\ntrumpet\ntrust\ntruth\ntry\ntube\ntuition\ntumble\ntuna\ntunnel\nturkey\nturn\nturtle\ntwelve\ntwenty\ntwice\ntwin\ntwist\ntwo\ntype\ntypical\nugly\numbrella\nunable\nunaware\nuncle\nuncover\nunder\nundo\nunfair\nunfold\nunhappy\nuniform\nunique\nunit\nuniverse\nunknown\nunlock\nuntil\nunusual\nunveil\nupdate\nupgrade\nuphold\nupon\nupper\nupset\nurban\nurge\nusage\nuse\nused\nuseful\nuseless\nusual\nutility\nvacant\nvacuum\nvague\nvalid\nvalley\nvalve\nvan\nvanish\nvapor\nvarious\nvast\nvault\nvehicle\nvelvet\nvendor\nventure\nvenue\nverb\nverify\nversion\nvery\nvessel\nveteran\nviable\nvibrant\nvicious\nvictory\nvideo\nview\nvillage\nvintage\nviolin\nvirtual\nvirus\nvisa\nvisit\nvisual\nvital\nvivid\nvocal\nvoice\nvoid\nvolcano\nvolume\nvote\nvoyage\nwage\nwagon\nwait\nwalk\nwall\nwalnut\nwant\nwarfare\nwarm\nwarrior\nwash\nwasp\nwaste\nwater\nwave\nway\nwealth\nweapon\nwear\nweasel\nweather\nweb\nwedding\nweekend\nweird\nwelcome\nwest\nwet\nwhale\nwhat\nwheat\nwheel\nwhen\nwhere\nwhip\nwhisper\nwide\nwidth\nwife\nwild\nwill\nwin\nwindow\nwine\nwing\nwink\nwinner\nwinter\nwire\nwisdom\nwise\nwish\nwitness\nwolf\nwoman\nwonder\nwood\nwool\nword\nwork\nworld\nworry\nworth\nwrap\nwreck\nwrestle\nwrist\nwrite\nwrong\nyard\nyear\nyellow\nyou\nyoung\nyouth\nzebra\nzero\nzone\nzoo\n");
+		const ANSICHAR* Previous = FHardcodedWordList::Words[i - 1];
+		const ANSICHAR* Current = FHardcodedWordList::Words[i];
+		int32 Char = 0;
+		while (Previous[Char] != 0 && Previous[Char] == Current[Char]) { Char++; }
+		if (static_cast<uint8>(Previous[Char]) >= static_cast<uint8>(Current[Char])) { return false; }
 	}
-};
\ No newline at end of file
+	return true;
+}(), "FHardcodedWordList::Find needs the words in ascending order");
@@ -36,7 +36,7 @@ UWallet::~UWallet()
 void UWallet::SetPublicKey(const FString& pubKey)
 {
 	PublicKey = pubKey;
-	Account.PublicKey = pubKey;
+	Account = FAccount::FromPublicKey(pubKey);
 }
 
 bool UWallet::IsValidPublicKey(const FString& pubKey)
@@ -58,6 +58,7 @@ USolanaWallet::USolanaWallet()
 	if (!HasAnyFlags(RF_ClassDefaultObject))
 	{
 		CurrentSaveData = NewObject<UWalletData>();
+		DerivationCache = MakeShared<FBip39DerivationCache>();
 	}
 }
 
@@ -92,7 +93,7 @@ bool USolanaWallet::SetSaveSlotName(FString NewSaveSlotName)
 		for (const auto& PublicKey : PublicKeys)
 		{
 			UWalletAccount* Account = NewObject<UWalletAccount>(this);
-			Account->AccountData.PublicKey = PublicKey;
+			Account->AccountData = FAccount::FromPublicKey(PublicKey);
 			Accounts.Add(PublicKey, Account);
 		}
 	}
@@ -254,7 +255,7 @@ bool USolanaWallet::UnlockWallet(FString Password, FText& FailReason)
 	for (int32 i = 0; i < CurrentSaveData->Accounts.Num(); ++i)
 	{
 		const FAccount& AccountData = CurrentSaveData->Accounts[i];
-		const FString& PublicKey = AccountData.PublicKey;
+		const FString& PublicKey = AccountData.GetPublicKeyString();
 		UWalletAccount* Account;
 		if (UWalletAccount* const* AccountPtr = Accounts.Find(PublicKey))
 		{
@@ -266,9 +267,10 @@ bool USolanaWallet::UnlockWallet(FString Password, FText& FailReason)
 			Accounts.Add(PublicKey, Account);
 		}
 		Account->AccountData = AccountData;
-		PublicKeys.Add(Account->AccountData.PublicKey);
+		PublicKeys.Add(Account->AccountData.GetPublicKeyString());
 	}
 
+	DerivationCache->Reset();
 	Mnemonic = WalletSaveData->Mnemonic;
 	OnMnemonicUpdated.Broadcast(Mnemonic.Mnemonic);
 
@@ -296,6 +298,7 @@ void USolanaWallet::LockWallet(bool bSaveWallet)
 	CurrentPassword.Empty();
 
 	Mnemonic = FMnemonic();
+	DerivationCache->Reset();
 
 	for (auto& [PublicKey, Account] : Accounts)
 	{
@@ -348,11 +351,20 @@ bool USolanaWallet::GetAccountsFromPath(FDerivationPath Path, int32 NumAccounts,
 
 	if (Mnemonic.Mnemonic.IsEmpty()) { return false; }
 
+	// The seed and the nodes above the accounts come from the cache, the rest of the paths are hashed as one batch and
+	// the keypairs built in parallel.
+	TArray<TArray<uint32>> Paths;
+	Paths.Reserve(NumAccounts);
+	for (int32 Index = 0; Index < NumAccounts; Index++) { Paths.Add(Path.GetDerivationPathSegments(Index)); }
+
+	TArray<TArray<uint8>> Seeds;
+	DerivationCache->DeriveAccountPaths(Mnemonic, Paths, Seeds);
+
 	ParallelFor(NumAccounts, [&](int32 Index)
 	{
-		FEd25519Bip39 Keypair(Mnemonic.DeriveSeed());
-		OutAccounts[Index] = FAccount::FromSeed(Keypair.DeriveAccountPath(Path.GetDerivationPathSegments(Index)));
+		OutAccounts[Index] = FAccount::FromSeed(Seeds[Index]);
 		OutAccounts[Index].GenIndex = Index;
+		FMemory::Memzero(Seeds[Index].GetData(), Seeds[Index].Num());
 	});
 
 	return true;
@@ -382,14 +394,15 @@ UWalletAccount* USolanaWallet::GenerateAccountFromGenIndex(int32 GenIndex)
 		return Account;
 	}
 	Account = NewObject<UWalletAccount>(this);
-	FEd25519Bip39 keypair(Mnemonic.DeriveSeed());
-	FAccount AccountData = FAccount::FromSeed(
-		keypair.DeriveAccountPath(CurrentSaveData->SelectedDerivationPath.GetDerivationPathSegments(GenIndex)));
+	TArray<TArray<uint8>> Seeds;
+	DerivationCache->DeriveAccountPaths(Mnemonic, { CurrentSaveData->SelectedDerivationPath.GetDerivationPathSegments(GenIndex) }, Seeds);
+	FAccount AccountData = FAccount::FromSeed(Seeds[0]);
+	FMemory::Memzero(Seeds[0].GetData(), Seeds[0].Num());
 	AccountData.Name = FString::Printf(TEXT("Wallet %i"), Accounts.Num() + 1);
 	AccountData.GenIndex = GenIndex;
 	Account->AccountData = AccountData;
-	Accounts.Add(AccountData.PublicKey, Account);
-	PublicKeys.Add(Account->AccountData.PublicKey);
+	Accounts.Add(AccountData.GetPublicKeyString(), Account);
+	PublicKeys.Add(Account->AccountData.GetPublicKeyString());
 	return Account;
 }
 
@@ -443,8 +456,8 @@ UWalletAccount* USolanaWallet::ImportAccountFromPrivateKey(FString PrivateKey)
 		Account->AccountData = FAccount::FromPrivateKey(PrivateKey);
 	}
 
-	Accounts.Add(Account->AccountData.PublicKey, Account);
-	PublicKeys.Add(Account->AccountData.PublicKey);
+	Accounts.Add(Account->AccountData.GetPublicKeyString(), Account);
+	PublicKeys.Add(Account->AccountData.GetPublicKeyString());
 	return Account;
 }
 
@@ -464,8 +477,8 @@ void USolanaWallet::RemoveAccount(UWalletAccount* Account)
 		return;
 	}
 
-	Accounts.Remove(Account->AccountData.PublicKey);
-	PublicKeys.Remove(Account->AccountData.PublicKey);
+	Accounts.Remove(Account->AccountData.GetPublicKeyString());
+	PublicKeys.Remove(Account->AccountData.GetPublicKeyString());
 }
 
 void USolanaWallet::RemoveAllAccounts()
@@ -509,16 +522,29 @@ void USolanaWallet::UpdateAccounts()
 	}
 
 	const auto Request = FRequestUtils::RequestMultipleAccounts(GetPublicKeys());
-	TArray<UWalletAccount*> CurrentAccounts = GetAccounts();
-	Request->Callback.BindLambda([this, CurrentAccounts](const FJsonObject& JsonResponse)
+	TArray<TWeakObjectPtr<UWalletAccount>> CurrentAccounts;
+	for (UWalletAccount* Account : GetAccounts())
+	{
+		CurrentAccounts.Add(Account);
+	}
+	Request->DecodeOffGameThread([](const FJsonObject& JsonResponse) { return FRequestUtils::ParseMultipleAccountsResponse(JsonResponse); },
+	                              [WeakThis = TWeakObjectPtr<USolanaWallet>(this), CurrentAccounts](const TArray<FAccountInfoJson>& Response)
 	{
-		const TArray<FAccountInfoJson> Response = FRequestUtils::ParseMultipleAccountsResponse(JsonResponse);
-		for (int32 Index = 0; Index < Response.Num(); ++Index)
+		// The wallet or some of its accounts may have been collected while the response was decoded.
+		USolanaWallet* Self = WeakThis.Get();
+		if (!Self)
+		{
+			return;
+		}
+
+		for (int32 Index = 0; Index < Response.Num() && Index < CurrentAccounts.Num(); ++Index)
 		{
-			const FAccountInfoJson& AccountInfoJson = Response[Index];
-			CurrentAccounts[Index]->UpdateFromAccountInfoJson(AccountInfoJson);
+			if (UWalletAccount* Account = CurrentAccounts[Index].Get())
+			{
+				Account->UpdateFromAccountInfoJson(Response[Index]);
+			}
 		}
-		OnAccountsUpdated.Broadcast();
+		Self->OnAccountsUpdated.Broadcast();
 	});
 	FRequestManager::SendRequest(Request);
 }
@@ -545,6 +571,7 @@ void USolanaWallet::ClipboardCopy(FString String)
 
 void USolanaWallet::InitMnemonic(const FMnemonic& InMnemonic)
 {
+	DerivationCache->Reset();
 	Mnemonic = InMnemonic;
 	PublicKeys.Empty();
 	Accounts.Empty();
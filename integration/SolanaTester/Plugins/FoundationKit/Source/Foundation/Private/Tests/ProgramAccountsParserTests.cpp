@@ -0,0 +1,195 @@
+/*
+Copyright 2022 ATMTA, Inc.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+	http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+#include "Misc/AutomationTest.h"
+#include "Network/ProgramAccountsParser.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace ProgramAccountsParserTests
+{
+	/**
+	 * Three accounts, the last with no data. The escaped strings hold quotes and brackets the parser must not count,
+	 * the top level one spells out a result array of its own.
+	 */
+	const ANSICHAR* Response =
+		"{\"jsonrpc\":\"2.0\",\"note\":\"\\\"result\\\":[{\\\"x\\\"}\",\"result\":["
+		"{\"account\":{\"data\":[\"AQIDBA==\",\"base64\"],\"executable\":false,\"lamports\":2039280,"
+		"\"owner\":\"TokenkegQfeZyiNwAJbNbGKPFXCWuBvf9Ss623VQ5DA\",\"rentEpoch\":18446744073709551615,\"space\":4},"
+		"\"note\":\"quoted \\\"}]\\\" \\\\ {[\",\"pubkey\":\"SysvarRent111111111111111111111111111111111\"},"
+		" {\"pubkey\":\"Vote111111111111111111111111111111111111111\",\"account\":{\"lamports\":1,\"executable\":true,"
+		"\"data\":[\"SGVsbG8sIFNvbGFuYSE=\",\"base64\"],\"owner\":\"11111111111111111111111111111111\",\"rentEpoch\":361}},"
+		" {\"pubkey\":\"TokenkegQfeZyiNwAJbNbGKPFXCWuBvf9Ss623VQ5DA\",\"account\":{\"data\":[\"\",\"base64\"],"
+		"\"executable\":true,\"lamports\":0,\"owner\":\"BPFLoaderUpgradeab1e11111111111111111111111\",\"rentEpoch\":0}}"
+		"],\"id\":1}";
+
+	const ANSICHAR* EmptyResponse = "{\"jsonrpc\":\"2.0\",\"result\":[],\"id\":1}";
+
+	const ANSICHAR* ErrorResponse =
+		"{\"jsonrpc\":\"2.0\",\"error\":{\"code\":-32602,\"message\":\"Invalid param: \\\"owner\\\" {]\"},\"id\":1}";
+
+	const ANSICHAR* Base58Response =
+		"{\"jsonrpc\":\"2.0\",\"result\":[{\"account\":{\"data\":[\"2UzHM\",\"base58\"],\"executable\":false,"
+		"\"lamports\":1,\"owner\":\"11111111111111111111111111111111\",\"rentEpoch\":0},"
+		"\"pubkey\":\"Vote111111111111111111111111111111111111111\"}],\"id\":1}";
+
+	struct FExpected
+	{
+		const TCHAR* Pubkey;
+		const TCHAR* Owner;
+		uint64 Lamports;
+		TArray<uint8> Data;
+	};
+
+	TArray<FExpected> GetExpected()
+	{
+		const ANSICHAR* Hello = "Hello, Solana!";
+		return {
+			{ TEXT("SysvarRent111111111111111111111111111111111"), TEXT("TokenkegQfeZyiNwAJbNbGKPFXCWuBvf9Ss623VQ5DA"), 2039280,
+				{ 1, 2, 3, 4 } },
+			{ TEXT("Vote111111111111111111111111111111111111111"), TEXT("11111111111111111111111111111111"), 1,
+				TArray<uint8>(reinterpret_cast<const uint8*>(Hello), FCStringAnsi::Strlen(Hello)) },
+			{ TEXT("TokenkegQfeZyiNwAJbNbGKPFXCWuBvf9Ss623VQ5DA"), TEXT("BPFLoaderUpgradeab1e11111111111111111111111"), 0, {} },
+		};
+	}
+
+	// What the sink saw, copied out since the views only live for the call.
+	struct FParsed
+	{
+		TArray<FPublicKey> Pubkeys;
+		TArray<FPublicKey> Owners;
+		TArray<uint64> Lamports;
+		TArray<TArray<uint8>> Data;
+		bool bFed = true;
+		bool bFinished = false;
+		FString Error;
+	};
+
+	// Feeds the first Length bytes of Body in chunks of MinChunk to MaxChunk bytes, as the HTTP stream would.
+	FParsed Parse(const ANSICHAR* Body, int32 Length, int32 MinChunk, int32 MaxChunk, int32 Seed)
+	{
+		FParsed Parsed;
+		FProgramAccountsParser Parser([&Parsed](const FProgramAccountView& Account)
+		{
+			Parsed.Pubkeys.Add(Account.Pubkey);
+			Parsed.Owners.Add(Account.Owner);
+			Parsed.Lamports.Add(Account.Lamports);
+			Parsed.Data.Add(TArray<uint8>(Account.Data.GetData(), Account.Data.Num()));
+		});
+
+		FRandomStream Stream(Seed);
+		const uint8* Bytes = reinterpret_cast<const uint8*>(Body);
+		for (int32 Offset = 0; Offset < Length && Parsed.bFed;)
+		{
+			const int32 Size = FMath::Min(Stream.RandRange(MinChunk, MaxChunk), Length - Offset);
+			Parsed.bFed = Parser.Feed(TConstArrayView<uint8>(Bytes + Offset, Size));
+			Offset += Size;
+		}
+		Parsed.bFinished = Parser.Finish();
+		Parsed.Error = Parser.GetError();
+		return Parsed;
+	}
+
+	FParsed ParseAll(const ANSICHAR* Body, int32 MinChunk, int32 MaxChunk, int32 Seed = 0)
+	{
+		return Parse(Body, FCStringAnsi::Strlen(Body), MinChunk, MaxChunk, Seed);
+	}
+} // namespace ProgramAccountsParserTests
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FProgramAccountsParserTest, "Foundation.Network.ProgramAccountsParser",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::EngineFilter)
+
+bool FProgramAccountsParserTest::RunTest(const FString& Parameters)
+{
+	using namespace ProgramAccountsParserTests;
+
+	const TArray<FExpected> Expected = GetExpected();
+	const int32 Length = FCStringAnsi::Strlen(Response);
+
+	// Every split of the body must deliver the same accounts, a chunk boundary can fall inside any token.
+	struct FSplit
+	{
+		const TCHAR* Name;
+		int32 MinChunk;
+		int32 MaxChunk;
+		int32 Seed;
+	};
+	const FSplit Splits[] = {
+		{ TEXT("whole"), Length, Length, 0 },
+		{ TEXT("1 byte chunks"), 1, 1, 0 },
+		{ TEXT("random chunks, seed 1"), 1, 64, 1 },
+		{ TEXT("random chunks, seed 2"), 1, 7, 2 },
+		{ TEXT("random chunks, seed 3"), 16, 512, 3 },
+	};
+	for (const FSplit& Split : Splits)
+	{
+		const FParsed Parsed = ParseAll(Response, Split.MinChunk, Split.MaxChunk, Split.Seed);
+		TestTrue(*FString::Printf(TEXT("%s: fed"), Split.Name), Parsed.bFed);
+		TestTrue(*FString::Printf(TEXT("%s: finished"), Split.Name), Parsed.bFinished);
+		if (!TestEqual(*FString::Printf(TEXT("%s: account count"), Split.Name), Parsed.Pubkeys.Num(), Expected.Num()))
+		{
+			continue;
+		}
+
+		for (int32 i = 0; i < Expected.Num(); i++)
+		{
+			TestTrue(*FString::Printf(TEXT("%s: account %d pubkey"), Split.Name, i),
+				Parsed.Pubkeys[i] == FPublicKey(FString(Expected[i].Pubkey)));
+			TestTrue(*FString::Printf(TEXT("%s: account %d owner"), Split.Name, i),
+				Parsed.Owners[i] == FPublicKey(FString(Expected[i].Owner)));
+			TestEqual(*FString::Printf(TEXT("%s: account %d lamports"), Split.Name, i), Parsed.Lamports[i], Expected[i].Lamports);
+			TestEqual(*FString::Printf(TEXT("%s: account %d data"), Split.Name, i), Parsed.Data[i], Expected[i].Data);
+		}
+	}
+
+	const FParsed Empty = ParseAll(EmptyResponse, 1, 1);
+	TestTrue(TEXT("An empty result finishes"), Empty.bFed && Empty.bFinished);
+	TestEqual(TEXT("An empty result has no accounts"), Empty.Pubkeys.Num(), 0);
+
+	// The error object arrives instead of a result, its message becomes the parser's error.
+	for (const int32 MaxChunk : { 1, 5, 1000 })
+	{
+		const FParsed Error = ParseAll(ErrorResponse, 1, MaxChunk, MaxChunk);
+		TestFalse(*FString::Printf(TEXT("An error response stops the feed, chunks of up to %d"), MaxChunk), Error.bFed);
+		TestFalse(*FString::Printf(TEXT("An error response does not finish, chunks of up to %d"), MaxChunk), Error.bFinished);
+		TestTrue(*FString::Printf(TEXT("The error message is kept, chunks of up to %d"), MaxChunk),
+			Error.Error.Contains(TEXT("Invalid param")));
+	}
+
+	const FParsed Base58 = ParseAll(Base58Response, 1, 1);
+	TestFalse(TEXT("Base58 data is rejected"), Base58.bFed || Base58.bFinished);
+	TestEqual(TEXT("Base58 data delivers no account"), Base58.Pubkeys.Num(), 0);
+
+	// Cut inside the second account, the first is delivered but the body cannot finish.
+	const FParsed Truncated = Parse(Response, Length / 2, 1, 9, 4);
+	TestTrue(TEXT("A truncated body feeds"), Truncated.bFed);
+	TestFalse(TEXT("A truncated body does not finish"), Truncated.bFinished);
+	TestFalse(TEXT("A truncated body reports why"), Truncated.Error.IsEmpty());
+	if (TestEqual(TEXT("A truncated body delivers the complete accounts"), Truncated.Pubkeys.Num(), 1))
+	{
+		TestTrue(TEXT("A truncated body delivers the first account"),
+			Truncated.Pubkeys[0] == FPublicKey(FString(Expected[0].Pubkey)) && Truncated.Data[0] == Expected[0].Data);
+	}
+
+	// Every account complete, only the closing bracket of the result missing.
+	int32 ResultEnd = Length - 1;
+	while (Response[ResultEnd] != ']') { ResultEnd--; }
+	const FParsed Unclosed = Parse(Response, ResultEnd, 1, 3, 5);
+	TestEqual(TEXT("An unclosed result delivers every account"), Unclosed.Pubkeys.Num(), Expected.Num());
+	TestFalse(TEXT("An unclosed result does not finish"), Unclosed.bFinished);
+	return true;
+}
+
+#endif
@@ -0,0 +1,148 @@
+/*
+Copyright 2022 ATMTA, Inc.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+	http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+#include "Misc/AutomationTest.h"
+#include "Crypto/CryptoUtils.h"
+#include "Crypto/SignatureBatch.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace SignatureBatchTests
+{
+	constexpr int32 Count = 8;
+
+	/**
+	 * A signature of 32 bytes of 0x4d by the key of seed 0x03.., made with R = rB + T, T the point of order 2. It
+	 * satisfies the cofactored equation but not the cofactorless one, no standard signer produces it.
+	 */
+	const TCHAR* MixedOrderKey = TEXT("ed4928c628d1c2c6eae90338905995612959273a5c63f93636c14614ac8737d1");
+	const TCHAR* MixedOrderSignature = TEXT("2d70f178add2f7de310b402df1491d8cd54407716c5e25ca0068ed3bc4173856"
+		"8f941b09cf27c6f4ac59747dd36ad0d1fe285cca3abf8140147a74af4bc0b205");
+
+	struct FSigned
+	{
+		TArray<uint8> Message;
+		TArray<uint8> Signature;
+		TArray<uint8> PublicKey;
+	};
+
+	FSigned SignRandom()
+	{
+		FSigned       Signed;
+		TArray<uint8> Seed;
+		TArray<uint8> PrivateKey;
+		FCryptoUtils::RandomBytes(Seed, 32);
+		FCryptoUtils::RandomBytes(Signed.Message, 64);
+		Signed.PublicKey.SetNum(32);
+		PrivateKey.SetNum(64);
+		Signed.Signature.SetNum(64);
+		FCryptoUtils::GenerateKeyPair(Seed, Signed.PublicKey, PrivateKey);
+		FCryptoUtils::SignMessage(Signed.Signature, Signed.Message, PrivateKey);
+		return Signed;
+	}
+
+	FSigned MakeMixedOrder()
+	{
+		FSigned Signed;
+		Signed.Message.Init(0x4d, 32);
+		Signed.PublicKey.SetNum(32);
+		Signed.Signature.SetNum(64);
+		HexToBytes(MixedOrderKey, Signed.PublicKey.GetData());
+		HexToBytes(MixedOrderSignature, Signed.Signature.GetData());
+		return Signed;
+	}
+
+	// Adds the group order l to s, giving the same point equation with a scalar RFC 8032 rejects.
+	FSigned AddGroupOrder(const FSigned& Signed)
+	{
+		static const uint8 L[32] = {
+			0xed, 0xd3, 0xf5, 0x5c, 0x1a, 0x63, 0x12, 0x58, 0xd6, 0x9c, 0xf7, 0xa2, 0xde, 0xf9, 0xde, 0x14,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10 };
+
+		FSigned Malleated = Signed;
+		int32   Carry = 0;
+		for (int32 i = 0; i < 32; i++)
+		{
+			Carry += Malleated.Signature[32 + i] + L[i];
+			Malleated.Signature[32 + i] = static_cast<uint8>(Carry);
+			Carry >>= 8;
+		}
+		return Malleated;
+	}
+
+	// Verdict of Tested, verified first in a batch with Others.
+	bool VerifyAmong(const FSigned& Tested, const TArray<FSigned>& Others)
+	{
+		FSignatureBatch Batch;
+		Batch.Add(Tested.Message, Tested.Signature, Tested.PublicKey);
+		for (const FSigned& Other : Others) { Batch.Add(Other.Message, Other.Signature, Other.PublicKey); }
+
+		TArray<bool> Valid;
+		Batch.Verify(Valid);
+		return Valid[0];
+	}
+} // namespace SignatureBatchTests
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSignatureBatchTest, "Foundation.Crypto.SignatureBatch",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::EngineFilter)
+
+bool FSignatureBatchTest::RunTest(const FString& Parameters)
+{
+	using namespace SignatureBatchTests;
+
+	TArray<FSigned> Honest;
+	for (int32 i = 0; i < Count; i++) { Honest.Add(SignRandom()); }
+
+	// A wrong s still decodes, so the bad signature takes part in the combination and makes it fail.
+	TArray<FSigned> WithBad = Honest;
+	WithBad[0].Signature[32] ^= 1;
+
+	FSignatureBatch Batch;
+	for (const FSigned& Signed : WithBad) { Batch.Add(Signed.Message, Signed.Signature, Signed.PublicKey); }
+
+	TArray<bool> Valid;
+	TestFalse(TEXT("Batch with a bad signature fails"), Batch.Verify(Valid));
+
+	int32 Reported = 0;
+	for (const bool bValid : Valid) { Reported += bValid ? 0 : 1; }
+	TestFalse(TEXT("Bad signature is reported"), Valid[0]);
+	TestEqual(TEXT("Only the bad signature is reported"), Reported, 1);
+
+	// Alone, next to valid signatures and next to a bad one, each path of the batch gives the same verdict.
+	const FSigned MixedOrder = MakeMixedOrder();
+	TestFalse(TEXT("Mixed order signature fails the cofactorless check"),
+		FCryptoUtils::VerifyMessage(MixedOrder.Signature, MixedOrder.Message, MixedOrder.PublicKey));
+	TestTrue(TEXT("Mixed order signature alone"), VerifyAmong(MixedOrder, {}));
+	TestTrue(TEXT("Mixed order signature in a valid batch"), VerifyAmong(MixedOrder, Honest));
+	TestTrue(TEXT("Mixed order signature in a failing batch"), VerifyAmong(MixedOrder, WithBad));
+
+	FSignatureBatch Strict;
+	Strict.Add(MixedOrder.Message, MixedOrder.Signature, MixedOrder.PublicKey);
+	TestFalse(TEXT("Mixed order signature fails the strict check"), Strict.VerifyStrict());
+
+	// s + l satisfies the same equations as s, it must be rejected or signatures are malleable.
+	const FSigned Malleated = AddGroupOrder(Honest[0]);
+	TestFalse(TEXT("s + l alone"), VerifyAmong(Malleated, {}));
+	TestFalse(TEXT("s + l in a valid batch"), VerifyAmong(Malleated, Honest));
+
+	FSignatureBatch Malleable;
+	Malleable.Add(Malleated.Message, Malleated.Signature, Malleated.PublicKey);
+	for (const FSigned& Signed : Honest) { Malleable.Add(Signed.Message, Signed.Signature, Signed.PublicKey); }
+	TestFalse(TEXT("s + l fails Verify"), Malleable.Verify());
+	TestFalse(TEXT("s + l fails VerifyStrict"), Malleable.VerifyStrict());
+	return true;
+}
+
+#endif
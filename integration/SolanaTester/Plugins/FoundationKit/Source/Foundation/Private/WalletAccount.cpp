@@ -41,7 +41,7 @@ void UWalletAccount::Update()
 
 void UWalletAccount::UpdateData()
 {
-	const auto Request = FRequestUtils::RequestAccountInfo(AccountData.PublicKey, ERequestEncoding::Base58);
+	const auto Request = FRequestUtils::RequestAccountInfo(AccountData.GetPublicKeyString(), ERequestEncoding::Base58);
 	Request->Callback.BindLambda([this](FJsonObject& Data)
 	{
 		const FAccountInfoJson response = FRequestUtils::ParseAccountInfoResponse(Data);
@@ -52,36 +52,50 @@ void UWalletAccount::UpdateData()
 
 void UWalletAccount::UpdateTokenAccounts()
 {
-	const auto Request = FRequestUtils::RequestAllTokenAccounts(AccountData.PublicKey,
+	const auto Request = FRequestUtils::RequestAllTokenAccounts(AccountData.GetPublicKeyString(),
 	                                                            "TokenkegQfeZyiNwAJbNbGKPFXCWuBvf9Ss623VQ5DA");
-	Request->Callback.BindLambda([this](FJsonObject& Data)
+	// Token account lists can be long, they are converted off the game thread.
+	Request->DecodeOffGameThread([](FJsonObject& Data)
 	{
-		TokenAccounts.Empty();
+		TOptional<FTokenAccountArrayJson> jsonData;
 		if (const TSharedPtr<FJsonObject> result = Data.GetObjectField("result"))
 		{
-			FTokenAccountArrayJson jsonData;
-			FJsonObjectConverter::JsonObjectToUStruct(result.ToSharedRef(), &jsonData);
+			FJsonObjectConverter::JsonObjectToUStruct(result.ToSharedRef(), &jsonData.Emplace());
+		}
+		return jsonData;
+	}, [WeakThis = TWeakObjectPtr<UWalletAccount>(this)](const TOptional<FTokenAccountArrayJson>& Result)
+	{
+		// The account may have been collected while the response was decoded.
+		UWalletAccount* Self = WeakThis.Get();
+		if (!Self)
+		{
+			return;
+		}
 
+		Self->TokenAccounts.Empty();
+		if (Result.IsSet())
+		{
+			const FTokenAccountArrayJson& jsonData = Result.GetValue();
 			if (!jsonData.value.IsEmpty())
 			{
 				for (FTokenBalanceDataJson entry : jsonData.value)
 				{
 					FTokenInfoJson Info = entry.account.data.parsed.info;
 
-					UTokenAccount* TokenAccount = TokenAccounts.Contains(Info.mint)
-						                              ? TokenAccounts[Info.mint]
-						                              : NewObject<UTokenAccount>(this);
-					TokenAccounts.Add(Info.mint, TokenAccount);
+					UTokenAccount* TokenAccount = Self->TokenAccounts.Contains(Info.mint)
+						                              ? Self->TokenAccounts[Info.mint]
+						                              : NewObject<UTokenAccount>(Self);
+					Self->TokenAccounts.Add(Info.mint, TokenAccount);
 					FAccountData& account = TokenAccount->AccountData;
 					account.Pubkey = entry.pubkey;
 					account.Balance = Info.tokenAmount.uiAmount;
 					account.Mint = Info.mint;
 					TokenAccount->OnBalanceUpdated.Broadcast(TokenAccount, account.Balance);
-					OnTokenAccountAdded.Broadcast(this, TokenAccount);
+					Self->OnTokenAccountAdded.Broadcast(Self, TokenAccount);
 				}
 			}
 
-			OnTokenAccountReceived.Broadcast();
+			Self->OnTokenAccountReceived.Broadcast();
 		}
 	});
 	FRequestManager::SendRequest(Request);
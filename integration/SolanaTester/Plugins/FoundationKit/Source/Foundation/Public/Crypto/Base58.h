@@ -19,10 +19,37 @@ Author: Jon Sawler
 
 #include "CoreMinimal.h"
 
+/**
+ * FBase58
+ *
+ * Bitcoin alphabet base58 codec. 32 byte keys and 64 byte signatures go through fixed width paths that convert
+ * through base 58^5 limbs with 64 bit arithmetic; other lengths use the generic byte-at-a-time conversion.
+ * Leading zero bytes map to leading '1' characters in both directions.
+ */
 class FOUNDATION_API FBase58
 {
 public:
+	// Longest encodings of 32 and 64 bytes.
+	static constexpr int32 MaxEncoded32Size = 44;
+	static constexpr int32 MaxEncoded64Size = 88;
+
 	static FString       EncodeBase58(const uint8* data, int len);
-	static FString       EncodeBase58(TArray<uint8> Array);
+	static FString       EncodeBase58(const TArray<uint8>& Array);
 	static TArray<uint8> DecodeBase58(const FString& encoded);
-};
\ No newline at end of file
+
+	// Encodes exactly 32 bytes into Out, which must hold MaxEncoded32Size characters. Returns the encoded length.
+	static int32 Encode32(const uint8* Data, ANSICHAR* Out);
+	// Encodes exactly 64 bytes into Out, which must hold MaxEncoded64Size characters. Returns the encoded length.
+	static int32 Encode64(const uint8* Data, ANSICHAR* Out);
+
+	// Decodes a string that must represent exactly 32 bytes, returns false otherwise.
+	static bool Decode32(const TCHAR* Encoded, int32 Len, uint8* Out);
+	// Decodes a string that must represent exactly 64 bytes, returns false otherwise.
+	static bool Decode64(const TCHAR* Encoded, int32 Len, uint8* Out);
+
+	/**
+	 * Encodes Count consecutive values of Width bytes each, e.g. a contiguous array of public keys.
+	 * 32 and 64 byte values take the fixed width path.
+	 */
+	static TArray<FString> EncodeBase58Batch(const uint8* Data, int32 Count, int32 Width);
+};
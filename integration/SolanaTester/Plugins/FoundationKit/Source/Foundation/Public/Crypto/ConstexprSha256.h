@@ -0,0 +1,125 @@
+/*
+Copyright 2022 ATMTA, Inc.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+	http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include <array>
+
+/**
+ * SHA-256 usable in constant expressions, for digests of names known at compile time such as Anchor discriminators.
+ * It is far slower than FHashBatch or OpenSSL at runtime and is not meant for data.
+ */
+namespace ConstexprSha256
+{
+	inline constexpr int32 DigestSize = 32;
+
+	inline constexpr uint32 RoundConstants[64] = {
+		0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+		0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+		0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+		0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+		0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+		0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+		0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+		0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2,
+	};
+
+	inline constexpr uint32 InitialState[8] = {
+		0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a, 0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19,
+	};
+
+	constexpr uint32 Rotr(uint32 Value, int32 N) { return Value >> N | Value << (32 - N); }
+
+	constexpr void Compress(uint32 (&State)[8], const uint8 (&Block)[64])
+	{
+		uint32 W[64] = {};
+		for (int32 t = 0; t < 16; t++)
+		{
+			W[t] = static_cast<uint32>(Block[t * 4]) << 24 | static_cast<uint32>(Block[t * 4 + 1]) << 16
+				| static_cast<uint32>(Block[t * 4 + 2]) << 8 | Block[t * 4 + 3];
+		}
+		for (int32 t = 16; t < 64; t++)
+		{
+			const uint32 S0 = Rotr(W[t - 15], 7) ^ Rotr(W[t - 15], 18) ^ W[t - 15] >> 3;
+			const uint32 S1 = Rotr(W[t - 2], 17) ^ Rotr(W[t - 2], 19) ^ W[t - 2] >> 10;
+			W[t] = W[t - 16] + S0 + W[t - 7] + S1;
+		}
+
+		uint32 A = State[0], B = State[1], C = State[2], D = State[3], E = State[4], F = State[5], G = State[6], H = State[7];
+		for (int32 t = 0; t < 64; t++)
+		{
+			const uint32 T1 = H + (Rotr(E, 6) ^ Rotr(E, 11) ^ Rotr(E, 25)) + (E & F ^ ~E & G) + RoundConstants[t] + W[t];
+			const uint32 T2 = (Rotr(A, 2) ^ Rotr(A, 13) ^ Rotr(A, 22)) + (A & B | C & (A | B));
+			H = G;
+			G = F;
+			F = E;
+			E = D + T1;
+			D = C;
+			C = B;
+			B = A;
+			A = T1 + T2;
+		}
+
+		State[0] += A;
+		State[1] += B;
+		State[2] += C;
+		State[3] += D;
+		State[4] += E;
+		State[5] += F;
+		State[6] += G;
+		State[7] += H;
+	}
+
+	// Hashes the bytes of Size characters, which string literals give as UTF-8.
+	constexpr std::array<uint8, DigestSize> Hash(const ANSICHAR* Data, int32 Size)
+	{
+		uint32 State[8] = {};
+		for (int32 i = 0; i < 8; i++) { State[i] = InitialState[i]; }
+
+		// Whole blocks, then the tail with the 0x80 byte and the bit length, which may spill into one more block.
+		uint8 Block[64] = {};
+		int32 Offset = 0;
+		for (; Offset + 64 <= Size; Offset += 64)
+		{
+			for (int32 i = 0; i < 64; i++) { Block[i] = static_cast<uint8>(Data[Offset + i]); }
+			Compress(State, Block);
+		}
+
+		const int32 TailSize = Size - Offset;
+		for (int32 i = 0; i < 64; i++) { Block[i] = i < TailSize ? static_cast<uint8>(Data[Offset + i]) : 0; }
+		Block[TailSize] = 0x80;
+		if (TailSize >= 56)
+		{
+			Compress(State, Block);
+			for (uint8& Byte : Block) { Byte = 0; }
+		}
+
+		const uint64 Bits = static_cast<uint64>(Size) * 8;
+		for (int32 i = 0; i < 8; i++) { Block[63 - i] = static_cast<uint8>(Bits >> (i * 8)); }
+		Compress(State, Block);
+
+		std::array<uint8, DigestSize> Digest = {};
+		for (int32 i = 0; i < DigestSize; i++) { Digest[i] = static_cast<uint8>(State[i / 4] >> (24 - i % 4 * 8)); }
+		return Digest;
+	}
+
+	template <int32 N>
+	constexpr std::array<uint8, DigestSize> Hash(const ANSICHAR (&Literal)[N])
+	{
+		return Hash(Literal, N - 1);
+	}
+} // namespace ConstexprSha256
@@ -0,0 +1,53 @@
+/*
+Copyright 2022 ATMTA, Inc.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+	http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * FHashBatch
+ *
+ * Hashes many independent inputs at once. Inputs of the same number of blocks run side by side in the lanes of a
+ * vector register, 8 SHA-256 or 4 SHA-512 lanes with AVX2, 4 and 2 with NEON, so a batch costs a fraction of hashing
+ * every input on its own. On x86 CPUs with the SHA extensions one SHA-256 stream is already faster than 8 AVX2 lanes
+ * and inputs go through it one at a time. Kernels are picked on first use from what the CPU supports, with a portable
+ * fallback, and all of them produce the same digests.
+ *
+ * Meant for many small inputs such as PDA candidates or key derivation steps: every input is copied once to be
+ * padded, inputs longer than 1 KiB are hashed on their own.
+ */
+class FOUNDATION_API FHashBatch
+{
+public:
+	static constexpr int32 SHA256Size = 32;
+	static constexpr int32 SHA512Size = 64;
+
+	// Digest of every input in order, OutDigests receives Inputs.Num() * SHA256Size bytes.
+	static void SHA256(TConstArrayView<TConstArrayView<uint8>> Inputs, uint8* OutDigests);
+	// OutDigests receives Inputs.Num() * SHA512Size bytes.
+	static void SHA512(TConstArrayView<TConstArrayView<uint8>> Inputs, uint8* OutDigests);
+
+	// HMAC-SHA512 of every Data[i] under Keys[i], OutMacs receives Keys.Num() * SHA512Size bytes.
+	static void HMAC_SHA512(TConstArrayView<TConstArrayView<uint8>> Keys, TConstArrayView<TConstArrayView<uint8>> Data, uint8* OutMacs);
+
+	// One input, through the fastest single stream kernel.
+	static void SHA256(const uint8* Data, int32 Size, uint8* OutDigest);
+	static void SHA512(const uint8* Data, int32 Size, uint8* OutDigest);
+
+	// Names of the kernels in use, for logs and benchmarks.
+	static const TCHAR* GetSHA256Kernel();
+	static const TCHAR* GetSHA512Kernel();
+};
@@ -0,0 +1,66 @@
+/*
+Copyright 2022 ATMTA, Inc.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+	http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Crypto/SigningKey.h"
+#include "SolanaUtils/PublicKey.h"
+
+struct FAccount;
+
+/**
+ * FKeypairBatch
+ *
+ * Ed25519 keypairs generated in parallel into one buffer, as 64 byte Solana keypairs (the seed followed by the public
+ * key) back to back. Meant for load tests and servers that create accounts by the thousand: a keypair costs 64 bytes
+ * here, and an FAccount is only built for the ones that need it. The buffer is wiped on Reset and destruction.
+ *
+ * FAccount keeps base58 strings of both keys because Blueprints and saves read them, with the key bytes, the binary
+ * public key and the expanded signing key about 600 bytes per account. Accounts that are never shown should be used
+ * through the views below instead.
+ */
+class FOUNDATION_API FKeypairBatch
+{
+public:
+	static constexpr int32 KeypairSize = 64;
+	static constexpr int32 SeedSize = 32;
+
+	FKeypairBatch() = default;
+	FKeypairBatch(const FKeypairBatch&) = delete;
+	FKeypairBatch& operator=(const FKeypairBatch&) = delete;
+	~FKeypairBatch();
+
+	// Appends Count keypairs from random seeds. Returns false, adding nothing, if the random generator failed.
+	bool Generate(int32 Count);
+	// Appends one keypair per 32 byte seed.
+	void AddFromSeeds(TConstArrayView<uint8> Seeds);
+
+	int32 Num() const { return Keypairs.Num() / KeypairSize; }
+
+	const uint8* GetKeypair(int32 Index) const { return Keypairs.GetData() + Index * KeypairSize; }
+	FPublicKey   GetPublicKey(int32 Index) const { return FPublicKey(GetKeypair(Index) + SeedSize, FPublicKey::Size); }
+	// Encoded on every call, nothing is kept.
+	FString      GetPublicKeyString(int32 Index) const { return GetPublicKey(Index).ToBase58(); }
+	FSigningKey  GetSigningKey(int32 Index) const { return FSigningKey(GetKeypair(Index)); }
+	FAccount     ToAccount(int32 Index) const;
+
+	SIZE_T GetAllocatedSize() const { return Keypairs.GetAllocatedSize(); }
+
+	void Reset();
+
+private:
+	TArray<uint8> Keypairs;
+};
@@ -1,15 +1,56 @@
 ﻿#pragma once
 
 #include "CoreMinimal.h"
+#include "SolanaUtils/PublicKey.h"
 
+/**
+ * A program derived address and the bump seed that pushed it off the curve.
+ */
+struct FProgramAddress
+{
+	FPublicKey Address;
+	// INDEX_NONE if no bump produced an off-curve address.
+	int32 Bump = INDEX_NONE;
+
+	bool IsValid() const { return Bump != INDEX_NONE; }
+};
+
+/**
+ * Seeds and program of one address to derive in a batch.
+ */
+struct FProgramAddressQuery
+{
+	TArray<TArray<uint8>> Seeds;
+	FPublicKey            ProgramId;
+};
+
+/**
+ * Program derived address derivation.
+ *
+ * The seeds are hashed once into a SHA-256 midstate, each bump only hashes the bump, the program id and the
+ * "ProgramDerivedAddress" marker on top of a copy of it. FindProgramAddress results are kept in a bounded LRU cache
+ * keyed by seeds and program, so deriving the same address every frame costs one lookup.
+ */
 class FOUNDATION_API FProgramDerivedAccount
 {
 public:
+	static constexpr int32 MaxSeeds = 16;
+	static constexpr int32 MaxSeedLength = 32;
+	static constexpr int32 DefaultCacheCapacity = 4096;
+
 	static TTuple<FString, int32> FindProgramAddress(const TArray<TArray<uint8>>& Seeds, const TArray<uint8>& ProgramId);
 	static TTuple<FString, int32> FindProgramAddress(const TArray<FString>& Seeds, const TArray<uint8>& ProgramId);
 	static TArray<uint8> StringToByteArray(FString InString);
 
-private:
-	static FString CreateProgramAddress(const TArray<TArray<uint8>>& Seeds, TArray<uint8> ProgramId);
-	static bool IsOnCurve(TArray<uint8> HashOutput);
+	// Finds the highest bump that gives an off-curve address, going through the cache.
+	static FProgramAddress FindProgramAddress(const TArray<TArray<uint8>>& Seeds, const FPublicKey& ProgramId);
+
+	// Derives the addresses of every query across worker threads, OutAddresses follows the order of Queries.
+	static void FindProgramAddresses(const TArray<FProgramAddressQuery>& Queries, TArray<FProgramAddress>& OutAddresses);
+
+	// Address for seeds that already include the bump, returns false if it lands on the curve or the seeds are invalid.
+	static bool CreateProgramAddress(const TArray<TArray<uint8>>& Seeds, const FPublicKey& ProgramId, FPublicKey& OutAddress);
+
+	static void SetCacheCapacity(int32 Capacity);
+	static void ClearCache();
 };
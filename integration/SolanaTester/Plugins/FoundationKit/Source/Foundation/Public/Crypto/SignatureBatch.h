@@ -0,0 +1,65 @@
+/*
+Copyright 2022 ATMTA, Inc.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+	http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * FSignatureBatch
+ *
+ * Verifies many Ed25519 (message, signature, public key) triples at once. The signatures are checked together
+ * through a random linear combination, so a batch costs about half as much per signature as calling
+ * FAccount::Verify in a loop. When the combination fails, every signature is checked on its own to report
+ * which ones are bad.
+ *
+ * Verify() uses the cofactored equation of RFC 8032 on both paths, so a signature gets the same result whatever the
+ * rest of its batch. Like every check here it rejects s >= l. It can accept signatures with small order components, which no standard signer produces, that
+ * FAccount::Verify and the Solana runtime reject. VerifyStrict() applies the runtime's rules instead.
+ *
+ * The batch only keeps pointers: messages, signatures and keys must stay alive until Verify() returns.
+ */
+class FOUNDATION_API FSignatureBatch
+{
+public:
+	void Reserve(int32 Num);
+	void Reset();
+
+	// Signature is 64 bytes, PublicKey 32 bytes.
+	void Add(const uint8* Message, int32 MessageSize, const uint8* Signature, const uint8* PublicKey);
+	void Add(const TArray<uint8>& Message, const TArray<uint8>& Signature, const TArray<uint8>& PublicKey);
+
+	int32 Num() const { return Signatures.Num(); }
+
+	/**
+	 * @param OutValid Receives one entry per Add() call, in order.
+	 * @return true if every signature is valid.
+	 */
+	bool Verify(TArray<bool>& OutValid) const;
+	bool Verify() const;
+
+	/**
+	 * Checks every signature on its own with the rules of the Solana runtime: cofactorless, with a reduced s and
+	 * rejecting small order keys and R. Use it for transaction signatures, whose validity must match the cluster's.
+	 */
+	bool VerifyStrict(TArray<bool>& OutValid) const;
+	bool VerifyStrict() const;
+
+private:
+	TArray<const uint8*> Messages;
+	TArray<size_t>       MessageSizes;
+	TArray<const uint8*> Signatures;
+	TArray<const uint8*> PublicKeys;
+};
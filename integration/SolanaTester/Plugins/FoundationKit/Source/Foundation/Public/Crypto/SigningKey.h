@@ -0,0 +1,57 @@
+/*
+Copyright 2022 ATMTA, Inc.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+	http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * FSigningKey
+ *
+ * An Ed25519 private key expanded once. ed25519_sign hashes the 32 byte seed on every call to recover the secret
+ * scalar and the nonce prefix; this keeps both next to the public key, so each signature only hashes the message.
+ * The expanded key is wiped when the object is destroyed.
+ */
+class FOUNDATION_API FSigningKey
+{
+public:
+	static constexpr int32 SignatureSize = 64;
+
+	FSigningKey() = default;
+	// PrivateKey is a 64 byte Solana keypair: the 32 byte seed followed by the public key.
+	explicit FSigningKey(const uint8* PrivateKey);
+	explicit FSigningKey(const TArray<uint8>& PrivateKey);
+
+	FSigningKey(const FSigningKey&) = default;
+	FSigningKey& operator=(const FSigningKey&) = default;
+	~FSigningKey();
+
+	bool IsValid() const { return bValid; }
+	const uint8* GetPublicKey() const { return PublicKey; }
+
+	// Writes the signature of Message into OutSignature, which must hold SignatureSize bytes.
+	void Sign(const uint8* Message, int32 MessageSize, uint8* OutSignature) const;
+	TArray<uint8> Sign(const TArray<uint8>& Message) const;
+
+	// Signs Count messages, the signature of message i is written at OutSignatures + i * SignatureSize.
+	void SignMany(const uint8* const* Messages, const int32* MessageSizes, int32 Count, uint8* OutSignatures) const;
+	void SignMany(const TArray<TArray<uint8>>& Messages, TArray<uint8>& OutSignatures) const;
+
+private:
+	// Clamped secret scalar followed by the nonce prefix.
+	uint8 Expanded[64] = {};
+	uint8 PublicKey[32] = {};
+	bool  bValid = false;
+};
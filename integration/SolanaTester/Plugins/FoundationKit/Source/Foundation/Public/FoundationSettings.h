@@ -49,6 +49,21 @@ public:
 	UFUNCTION(BlueprintPure)
 	FString GetNetworkURL() const;
 
+	// Seconds requests wait to be sent together as one JSON-RPC batch, 0 sends them on the next tick.
+	UFUNCTION(BlueprintPure)
+	float GetRequestBatchWindow() const { return RequestBatchWindow; }
+
+	// Most requests sent in one batch to the current network, 1 or less sends every request on its own.
+	UFUNCTION(BlueprintPure)
+	int32 GetMaxRequestBatchSize() const;
+
+	// Most requests or batches in flight at once to the current network.
+	UFUNCTION(BlueprintPure)
+	int32 GetMaxRequestsInFlight() const;
+
+	UFUNCTION(BlueprintPure)
+	bool ShouldWarmUpConnection() const { return bWarmUpConnection; }
+
 protected:
 
 	UPROPERTY(BlueprintReadOnly, EditDefaultsOnly, Config)
@@ -56,4 +71,27 @@ protected:
 
 	UPROPERTY(BlueprintReadOnly, EditDefaultsOnly, Config)
 	ESolanaNetwork Network = ESolanaNetwork::DevNet;
+
+	UPROPERTY(BlueprintReadOnly, EditDefaultsOnly, Config, meta = (ClampMin = "0"))
+	float RequestBatchWindow = 0.f;
+
+	// Batch limits of the providers behind NetworkURLs, networks without an entry use DefaultMaxRequestBatchSize.
+	// Batching is opt-in, not every provider accepts JSON-RPC batches, so only list providers known to.
+	UPROPERTY(BlueprintReadOnly, EditDefaultsOnly, Config)
+	TMap<ESolanaNetwork, int32> MaxRequestBatchSizes;
+
+	UPROPERTY(BlueprintReadOnly, EditDefaultsOnly, Config)
+	int32 DefaultMaxRequestBatchSize = 1;
+
+	// Rate limits of the providers, networks without an entry use DefaultMaxRequestsInFlight. At least 1.
+	UPROPERTY(BlueprintReadOnly, EditDefaultsOnly, Config, meta = (ClampMin = "1"))
+	TMap<ESolanaNetwork, int32> MaxRequestsInFlight;
+
+	UPROPERTY(BlueprintReadOnly, EditDefaultsOnly, Config, meta = (ClampMin = "1"))
+	int32 DefaultMaxRequestsInFlight = 6;
+
+	// Connects to the provider and starts the blockhash cache when the module starts, so the first request does not pay
+	// for the TLS handshake and the first transaction does not wait for a blockhash. Games only, the editor never warms up.
+	UPROPERTY(BlueprintReadOnly, EditDefaultsOnly, Config)
+	bool bWarmUpConnection = true;
 };
\ No newline at end of file
@@ -0,0 +1,137 @@
+/*
+Copyright 2022 ATMTA, Inc.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+	http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include "SolanaUtils/PublicKey.h"
+
+/**
+ * A blockhash returned by getLatestBlockhash.
+ */
+struct FOUNDATION_API FBlockhashInfo
+{
+	FString Blockhash;
+	// Transactions using the hash are rejected once the cluster is past this block height.
+	uint64 LastValidBlockHeight = 0;
+	// Block height of the cluster at ReceivedTime, 0 if getBlockHeight failed.
+	uint64 BlockHeight = 0;
+	// FPlatformTime::Seconds() when BlockHeight was read, or when the hash arrived if it is unknown.
+	double ReceivedTime = 0.0;
+
+	// Whether a transaction using the hash is still accepted at CurrentBlockHeight.
+	bool IsValidAt(uint64 CurrentBlockHeight) const { return !Blockhash.IsEmpty() && CurrentBlockHeight <= LastValidBlockHeight; }
+
+	/**
+	 * Estimated seconds left before the hash expires: the blocks between BlockHeight and LastValidBlockHeight at 400 ms
+	 * each, less the time since ReceivedTime. The full 150 blocks are assumed while the height is unknown.
+	 */
+	double GetRemainingLifetime() const;
+};
+
+/**
+ * The state of an initialized durable nonce account.
+ */
+struct FOUNDATION_API FDurableNonce
+{
+	FPublicKey NonceAccount;
+	FPublicKey Authority;
+	// Used in place of the recent blockhash, a transaction stays valid until the nonce is advanced.
+	FString Nonce;
+	uint64  LamportsPerSignature = 0;
+
+	// Parses the 80 bytes of a nonce account, returns false if the account is not an initialized nonce.
+	static bool Deserialize(const FPublicKey& InNonceAccount, const TArray<uint8>& Data, FDurableNonce& OutNonce);
+};
+
+/**
+ * FBlockhashCache
+ *
+ * Keeps a recent blockhash at hand so building a transaction does not start with an RPC round trip. While running,
+ * it fetches getLatestBlockhash and getBlockHeight at the "confirmed" commitment on the core ticker, and again as soon
+ * as the cached hash gets within twice MinRemainingLifetime of its expiry, so a hash served synchronously always has
+ * time left to be signed, sent and processed. Games start it with the module when the connection warm-up is enabled,
+ * otherwise the first GetBlockhash does. A hash is dropped as soon as a fetched block height is past its LastValidBlockHeight.
+ *
+ * Long-lived, pre-signed transactions can use a durable nonce instead: FetchNonce reads the nonce account, the
+ * transaction takes the nonce as its blockhash and starts with the system program's AdvanceNonceAccount instruction.
+ */
+class FOUNDATION_API FBlockhashCache
+{
+public:
+	// A blockhash stays valid for 150 blocks after the one it was taken from.
+	static constexpr int32  MaxProcessingAge = 150;
+	static constexpr double SlotDuration = 0.4;
+
+	static FBlockhashCache& Get();
+
+	// Starts refreshing every RefreshInterval seconds, the first request goes out right away.
+	void Start(float RefreshInterval = 10.f);
+	// Stops refreshing, GetBlockhash does not start a stopped cache again.
+	void Stop();
+	bool IsRunning() const;
+
+	// Seconds of validity a hash must have left to be served, 20 by default.
+	void SetMinRemainingLifetime(double Seconds);
+
+	/**
+	 * Returns the newest cached hash if it has enough validity left, without waiting. Returns false while the cache is
+	 * cold or stale, a refresh is then already on its way.
+	 */
+	bool GetBlockhash(FBlockhashInfo& OutInfo);
+	bool GetBlockhash(FString& OutBlockhash);
+
+	// Calls OnReady with a valid hash, right away when one is cached, otherwise once the next refresh completes. OnReady receives nullptr if it fails.
+	void GetBlockhashAsync(TFunction<void(const FBlockhashInfo*)> OnReady);
+
+	// Fetches a new hash now, unless a request is already in flight.
+	void Refresh();
+
+	/**
+	 * Calls OnLoaded with the current nonce of a durable nonce account, fetching it if it is not cached.
+	 * OnLoaded receives nullptr if the account does not exist or is not an initialized nonce account.
+	 */
+	void FetchNonce(const FPublicKey& NonceAccount, TFunction<void(const FDurableNonce*)> OnLoaded);
+
+	// A transaction using the nonce advances it, drop it so the next FetchNonce reads the new value.
+	void InvalidateNonce(const FPublicKey& NonceAccount);
+
+private:
+	// The two responses of one refresh, applied together once both arrived.
+	struct FRefresh
+	{
+		FBlockhashInfo Info;
+		uint64         BlockHeight = 0;
+		double         BlockHeightTime = 0.0;
+		int32          Pending = 2;
+	};
+
+	void OnRefreshPart(const TSharedPtr<FRefresh>& State);
+	void OnRefreshed(const FRefresh& Result);
+
+	mutable FCriticalSection Lock;
+
+	FBlockhashInfo Latest;
+	double         MinRemainingLifetime = 20.0;
+	bool           bRefreshInFlight = false;
+	bool           bStarted = false;
+
+	TArray<TFunction<void(const FBlockhashInfo*)>> Waiters;
+
+	FTSTicker::FDelegateHandle TickerHandle;
+
+	TMap<FPublicKey, FDurableNonce> Nonces;
+};
@@ -0,0 +1,95 @@
+/*
+Copyright 2022 ATMTA, Inc.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+	http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+#pragma once
+
+#include "CoreMinimal.h"
+#include "SolanaUtils/PublicKey.h"
+
+/**
+ * One account of a getProgramAccounts response, as passed to a FProgramAccountsParser sink.
+ */
+struct FProgramAccountView
+{
+	FPublicKey Pubkey;
+	FPublicKey Owner;
+	uint64     Lamports = 0;
+	// u64 max for rent exempt accounts.
+	uint64     RentEpoch = 0;
+	bool       bExecutable = false;
+	// The decoded account data, only valid during the sink call.
+	TConstArrayView<uint8> Data;
+};
+
+/**
+ * FProgramAccountsParser
+ *
+ * Reads the UTF-8 body of a base64 encoded getProgramAccounts response as it arrives, in pieces of any size. Only the
+ * entry of the result array being read is kept: once it is complete, its keys and numbers are read in place, its data
+ * is decoded into a buffer reused from one account to the next and the account is passed to the sink. Peak memory
+ * follows the largest account rather than the whole response, and callers collecting accounts into an array they
+ * reserved up front copy only what they need.
+ *
+ * A JSON-RPC error, malformed JSON or data in another encoding stops the parse, GetError() then says why.
+ */
+class FOUNDATION_API FProgramAccountsParser
+{
+public:
+	using FSink = TFunction<void(const FProgramAccountView&)>;
+
+	explicit FProgramAccountsParser(FSink InSink);
+
+	// Parses the next piece of the body. Returns false once the body is known to be unusable.
+	bool Feed(TConstArrayView<uint8> Chunk);
+
+	// Call after the last piece. Returns false if the parse failed or the body ended before the result array did.
+	bool Finish();
+
+	const FString& GetError() const { return Error; }
+	int32          GetAccountCount() const { return AccountCount; }
+
+private:
+	enum class EState : uint8
+	{
+		Response,
+		Result,
+		Entry,
+		ErrorObject,
+		Done,
+		Failed
+	};
+
+	bool Fail(const FString& Reason);
+	bool ParseEntry();
+	void ParseErrorObject();
+
+	FSink  Sink;
+	EState State = EState::Response;
+
+	// Nesting outside the buffered object, 1 inside the response and 2 inside the result array.
+	int32 Depth = 0;
+	bool  bInString = false;
+	bool  bEscaped = false;
+	// The last string read in the response object, the key of the value that follows it.
+	TArray<uint8, TInlineAllocator<16>> Key;
+
+	// The result entry or error object being read, and the nesting inside it.
+	TArray<uint8> Buffer;
+	int32         BufferDepth = 0;
+
+	TArray<uint8> Data;
+	int32         AccountCount = 0;
+	FString       Error;
+};
@@ -0,0 +1,128 @@
+/*
+Copyright 2022 ATMTA, Inc.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+	http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+
+struct FRequestData;
+class FJsonObject;
+
+/**
+ * FRequestCache
+ *
+ * Sits in front of FRequestManager for read requests. Requests with the same method, params and commitment sent while
+ * one of them is in flight share its post, and its response or error is handed to every one of them. Responses of
+ * account reads are then kept for a short time to live chosen per method and commitment: a few hundred milliseconds
+ * at "processed", a little longer at "confirmed" and "finalized", whose data changes less often.
+ *
+ * Requests with a Decoder take part too: the response is parsed once and every waiter's decoder runs on a worker with
+ * its own copy. Streamed responses go to one caller only and are never shared.
+ *
+ * Transactions and airdrops are never shared. The writable accounts of every transaction sent through FRequestManager
+ * are invalidated once the transaction is confirmed, so the next read after one of our own changes goes to the network.
+ */
+class FOUNDATION_API FRequestCache
+{
+public:
+	static FRequestCache& Get();
+
+	/**
+	 * Handles a request FRequestManager was asked to send: joins it to an identical request in flight or answers it
+	 * from the cache on the next tick. Returns false if the request must be sent as usual.
+	 */
+	bool Intercept(const TSharedPtr<FRequestData>& RequestData);
+
+	// Stops waiting for a shared response, the shared request is cancelled once nobody waits for it.
+	void Cancel(FRequestData* RequestData);
+
+	// Seconds a response of Method at Commitment is served from the cache, 0 shares in-flight requests only.
+	void   SetTimeToLive(const FString& Method, const FString& Commitment, double Seconds);
+	double GetTimeToLive(const FString& Method, const FString& Commitment) const;
+
+	// Drops every cached response whose request params name Account, and keeps the ones in flight from being cached.
+	void Invalidate(const FString& Account);
+	/**
+	 * Invalidates Accounts once the transaction of Signature is confirmed or failed, polling its status in the background.
+	 * Transactions sent through FRequestManager are watched this way with their writable static accounts, accounts
+	 * loaded through lookup tables must be passed here by the caller.
+	 */
+	void InvalidateOnConfirmation(const FString& Signature, const TArray<FString>& Accounts);
+	void InvalidateMethod(const FString& Method);
+	void Clear();
+
+private:
+	FRequestCache();
+
+	struct FCachedResponse
+	{
+		TSharedPtr<FJsonObject> Response;
+		FString                 Method;
+		// The string values of the request's params, what Invalidate matches against.
+		TArray<FString>         Params;
+		double                  ExpiryTime = 0.0;
+	};
+
+	struct FWaiter
+	{
+		TSharedPtr<FRequestData> Request;
+		// Copied when the request joins, the worker never reads the request's own, which cancelling clears.
+		TFunction<TFunction<void()>(FJsonObject&)> Decoder;
+	};
+
+	struct FSharedRequest
+	{
+		TSharedPtr<FRequestData> Request;
+		TArray<FWaiter>          Waiters;
+		FString                  Method;
+		TArray<FString>          Params;
+		double                   TimeToLive = 0.0;
+		// Set when the accounts it reads changed while it was in flight.
+		bool                     bInvalidated = false;
+	};
+
+	struct FPendingTransaction
+	{
+		FString         Signature;
+		TArray<FString> Accounts;
+		double          ExpiryTime = 0.0;
+	};
+
+	// Decoded results of the waiters whose decoders already ran on the worker, by request.
+	using FDecodedResults = TMap<FRequestData*, TFunction<void()>>;
+
+	void OnResponse(const FString& Key, FJsonObject* Response, FString* Error, FDecodedResults* Decoded = nullptr);
+	FDecodedResults DecodeForWaiters(const FString& Key, FJsonObject& Response);
+	void RemoveExpired(double Now);
+
+	// Invalidates the writable accounts of a sendTransaction request once its first signature is confirmed.
+	void WatchTransaction(const TSharedPtr<FRequestData>& RequestData);
+	bool PollConfirmations();
+	void OnConfirmations(const TArray<FString>& Signatures, const FJsonObject* Response);
+
+	mutable FCriticalSection Lock;
+
+	// Keyed by "method/commitment".
+	TMap<FString, double> TimesToLive;
+
+	// Keyed by the network and the request body without its id.
+	TMap<FString, FCachedResponse> Responses;
+	TMap<FString, FSharedRequest>  InFlight;
+
+	TArray<FPendingTransaction> PendingTransactions;
+	FTSTicker::FDelegateHandle  ConfirmationHandle;
+	bool                        bPollingConfirmations = false;
+};
@@ -24,11 +24,40 @@ Contributers: Daniele Calanna, Riccardo Torrisi
 
 DECLARE_DELEGATE_OneParam(RequestCallback, FJsonObject&);
 DECLARE_DELEGATE_OneParam(RequestErrorCallback, FString& Error);
+DECLARE_DELEGATE_OneParam(RequestBodyCallback, TConstArrayView<uint8>);
 
 using RequestCB = TFunctionRef<void(FJsonObject&)>;
+// Runs on a worker with the parsed response, returns what is left to do on the game thread.
+using RequestDecoder = TFunction<TFunction<void()>(FJsonObject&)>;
 
 struct FOUNDATION_API FRequestData;
 
+// Order in which queued requests get a connection, highest first.
+enum class ERequestPriority : uint8
+{
+	Transaction,
+	Confirmation,
+	Interactive,
+	Background,
+	Count
+};
+
+/**
+ * FRequestManager
+ *
+ * Sends JSON-RPC requests to the network selected in UFoundationSettings. Requests sent within the settings' batch
+ * window are posted together as JSON-RPC batches of at most the provider's batch size, and every response is routed
+ * back to its request by id. A batch size of 1 sends each request on its own right away.
+ *
+ * Reads first go through FRequestCache, which shares identical requests in flight and answers repeated ones from its
+ * cache.
+ *
+ * At most the provider's MaxRequestsInFlight posts are in flight per URL, the others wait in one queue per priority.
+ * Transactions skip the batch window, and background polls never take the last free slot.
+ *
+ * Responses are parsed on the game thread, except for requests with a Decoder: their parsing and decoding run on a
+ * task graph worker, and only the decoded results come back, through a queue drained once per tick.
+ */
 class FOUNDATION_API FRequestManager
 {
 public:
@@ -37,6 +66,12 @@ public:
 
 	static void SendRequest(TSharedPtr<FRequestData> RequestData);
 	static void CancelRequest(FRequestData* RequestData);
+
+	// Sends the requests waiting for their batch window now.
+	static void Flush();
+
+	// Opens a connection to the provider ahead of the first request, called when the module starts.
+	static void WarmUp();
 };
 
 struct FOUNDATION_API FRequestData
@@ -48,7 +83,30 @@ struct FOUNDATION_API FRequestData
 
 	uint32 Id;
 	FString Body;
+	ERequestPriority Priority = ERequestPriority::Interactive;
+	// Skips FRequestCache, set on the requests it sends itself.
+	bool bBypassCache = false;
 	TSharedPtr<FJsonObject> Response;
 	RequestCallback Callback;
 	RequestErrorCallback ErrorCallback;
+	// When bound, receives the UTF-8 response body in pieces as it arrives, on the HTTP thread, and no JSON object is
+	// built: Callback then gets an empty object once the body is complete. Such requests are never batched or cached.
+	RequestBodyCallback BodyCallback;
+	// When set, replaces Callback, see DecodeOffGameThread.
+	RequestDecoder Decoder;
+
+	/**
+	 * Parses the response and passes it to Decode on a task graph worker, then hands Decode's result to OnDecoded on the
+	 * game thread, on the first tick after it is ready. Decode must not touch UObjects. Errors still go to ErrorCallback.
+	 * Such requests are never batched, but FRequestCache still shares and caches their responses, running Decode once
+	 * per request on a copy.
+	 */
+	template <typename DecodeFunc, typename ResultFunc>
+	void DecodeOffGameThread(DecodeFunc Decode, ResultFunc OnDecoded)
+	{
+		Decoder = [Decode = MoveTemp(Decode), OnDecoded = MoveTemp(OnDecoded)](FJsonObject& Data) -> TFunction<void()>
+		{
+			return [Result = Decode(Data), OnDecoded]() mutable { OnDecoded(MoveTemp(Result)); };
+		};
+	}
 };
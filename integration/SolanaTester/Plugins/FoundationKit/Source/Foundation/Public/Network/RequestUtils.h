@@ -26,6 +26,7 @@ struct FAccountInfoJson;
 struct FBalanceResultJson;
 struct FTokenAccountArrayJson;
 struct FProgramAccountJson;
+struct FProgramAccountView;
 
 class FOUNDATION_API FRequestUtils
 {
@@ -46,12 +47,23 @@ public:
 	static TSharedPtr<FRequestData> RequestProgramAccounts(const FString& programID, const uint32& size,
 	                                                       const FString& pubKey);
 	static TArray<FProgramAccountJson> ParseProgramAccountsResponse(const FJsonObject& data);
+	/**
+	 * Streams the response of a RequestProgramAccounts request into Sink as it arrives instead of building a JSON object,
+	 * see FProgramAccountsParser. Sink runs on the HTTP thread, OnComplete on the game thread with an empty error on success.
+	 */
+	static void StreamProgramAccountsResponse(FRequestData& request, TFunction<void(const FProgramAccountView&)> Sink,
+	                                          TFunction<void(const FString& Error)> OnComplete);
 
 	static TSharedPtr<FRequestData> RequestMultipleAccounts(const TArray<FString>& pubKey);
 	static TArray<FAccountInfoJson> ParseMultipleAccountsResponse(const FJsonObject& data);
 
 	static TSharedPtr<FRequestData> RequestBlockHash();
 	static FString ParseBlockHashResponse(const FJsonObject& data);
+	static bool ParseLatestBlockHashResponse(const FJsonObject& data, FString& OutBlockHash, uint64& OutLastValidBlockHeight);
+
+	// Current block height at the "confirmed" commitment, comparable with lastValidBlockHeight.
+	static TSharedPtr<FRequestData> RequestBlockHeight();
+	static bool ParseBlockHeightResponse(const FJsonObject& data, uint64& OutBlockHeight);
 
 	static TSharedPtr<FRequestData> GetTransactionFeeAmount(const FString& transaction);
 	static int ParseTransactionFeeAmountResponse(const FJsonObject& data);
@@ -59,8 +71,17 @@ public:
 	static TSharedPtr<FRequestData> SendTransaction(const FString& transaction);
 	static FString ParseTransactionResponse(const FJsonObject& data);
 
+	// Simulates a base64 transaction without checking its signatures, against the latest blockhash.
+	static TSharedPtr<FRequestData> SimulateTransaction(const FString& transaction);
+	static bool ParseSimulateTransactionResponse(const FJsonObject& data, uint64& OutUnitsConsumed);
+
 	static TSharedPtr<FRequestData> RequestAirDrop(const FString& pubKey);
 
+	// Statuses of at most 256 signatures, searching the transaction history for the ones no longer in the recent cache.
+	static TSharedPtr<FRequestData> RequestSignatureStatuses(const TArray<FString>& signatures);
+	// One entry per requested signature: its confirmationStatus, "failed" if it has an error, empty if it is unknown.
+	static bool ParseSignatureStatusesResponse(const FJsonObject& data, TArray<FString>& OutStatuses);
+
 	static void DisplayError(const FString& error);
 	static void DisplayInfo(const FString& info);
 };
@@ -18,6 +18,8 @@ Contributers: Daniele Calanna, Riccardo Torrisi
 */
 #pragma once
 
+#include "Crypto/SigningKey.h"
+#include "SolanaUtils/PublicKey.h"
 #include "Account.generated.h"
 
 USTRUCT(BlueprintType)
@@ -33,6 +35,8 @@ struct FOUNDATION_API FAccount
 	UPROPERTY(SaveGame, BlueprintReadOnly)
 	int32 GenIndex = -1;
 
+	// Base58 forms of the keys, filled by every factory and on load since Blueprints and saves read them directly.
+	// PrivateKey is empty for accounts created from a public key.
 	UPROPERTY(SaveGame, BlueprintReadOnly)
 	FString PublicKey;
 	UPROPERTY(SaveGame, BlueprintReadOnly)
@@ -40,11 +44,28 @@ struct FOUNDATION_API FAccount
 
 	UPROPERTY(SaveGame, NotBlueprintable)
 	TArray<uint8> PublicKeyData;
+	// Empty for accounts created from a public key.
 	UPROPERTY(SaveGame, NotBlueprintable)
 	TArray<uint8> PrivateKeyData;
 
-	TArray<uint8> Sign(const TArray<uint8>& Transaction);
-	void Verify(const TArray<uint8>& Transaction, const TArray<uint8>& Signature);
+	// Binary form of PublicKeyData, rebuilt after loading so transactions never decode the key again.
+	FPublicKey Key;
+
+	// PrivateKeyData expanded once, so signing does not hash the seed on every call.
+	FSigningKey SigningKey;
+
+	void PostSerialize(const FArchive& Ar);
+
+	const FString& GetPublicKeyString() const { return PublicKey; }
+	// Empty if the account has no private key.
+	const FString& GetPrivateKeyString() const { return PrivateKey; }
+
+	bool HasPrivateKey() const;
+
+	TArray<uint8> Sign(const TArray<uint8>& Transaction) const;
+	// Writes the 64 byte signature of Message into OutSignature without allocating.
+	void Sign(const uint8* Message, int32 MessageSize, uint8* OutSignature) const;
+	bool Verify(const TArray<uint8>& Transaction, const TArray<uint8>& Signature) const;
 
 	static FAccount FromSeed(const TArray<uint8>& Seed);
 
@@ -61,4 +82,17 @@ struct FOUNDATION_API FAccount
 
 	static FString GetShortDisplayablePublicKey(const FString& PublicKey, int32 InitialCharsCount = 6,
 	                                            int32 FinalCharsCount = 4);
+
+private:
+	// Encodes PublicKey and PrivateKey from the key data.
+	void EncodeKeyStrings();
+};
+
+template <>
+struct TStructOpsTypeTraits<FAccount> : TStructOpsTypeTraitsBase2<FAccount>
+{
+	enum
+	{
+		WithPostSerialize = true,
+	};
 };
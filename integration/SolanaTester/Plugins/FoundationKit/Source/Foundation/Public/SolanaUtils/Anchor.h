@@ -1,8 +1,54 @@
 ﻿#pragma once
 
 #include "CoreMinimal.h"
+#include "Crypto/ConstexprSha256.h"
 
 extern inline const FString StateNamespace = TEXT("state");
 extern inline const FString GlobalNamespace = TEXT("global");
 
 TArray<uint8> GetAnchorInstructionSighash(const FString& Namespace, const FString& IxName);
+
+/**
+ * The first 8 bytes of SHA-256("<namespace>:<name>"), which Anchor writes in front of instruction and account data.
+ */
+struct FAnchorDiscriminator
+{
+	static constexpr int32 Size = 8;
+
+	std::array<uint8, Size> Bytes = {};
+
+	// The bytes as the little endian integer a program reads from the start of the data.
+	constexpr uint64 ToU64() const
+	{
+		uint64 Value = 0;
+		for (int32 i = Size - 1; i >= 0; i--) { Value = Value << 8 | Bytes[i]; }
+		return Value;
+	}
+
+	TArray<uint8> ToArray() const { return TArray<uint8>(Bytes.data(), Size); }
+
+	// Whether account or instruction data starts with this discriminator.
+	bool Matches(TConstArrayView<uint8> Data) const { return Data.Num() >= Size && FMemory::Memcmp(Data.GetData(), Bytes.data(), Size) == 0; }
+
+	constexpr bool operator==(const FAnchorDiscriminator& Other) const { return Bytes == Other.Bytes; }
+};
+
+template <int32 N>
+consteval FAnchorDiscriminator MakeAnchorDiscriminator(const ANSICHAR (&Preimage)[N])
+{
+	const std::array<uint8, ConstexprSha256::DigestSize> Hash = ConstexprSha256::Hash(Preimage);
+
+	FAnchorDiscriminator Discriminator;
+	for (int32 i = 0; i < FAnchorDiscriminator::Size; i++) { Discriminator.Bytes[i] = Hash[i]; }
+	return Discriminator;
+}
+
+/**
+ * Discriminators computed by the compiler, from string literals only. Names are hashed as written: instructions use
+ * their snake case name, accounts their type name.
+ *
+ *   constexpr FAnchorDiscriminator MoveLeft = ANCHOR_DISCRIMINATOR("global", "move_left");
+ *   constexpr uint64 GameData = ANCHOR_ACCOUNT_DISCRIMINATOR("GameDataAccount").ToU64();
+ */
+#define ANCHOR_DISCRIMINATOR(Namespace, Name) MakeAnchorDiscriminator(Namespace ":" Name)
+#define ANCHOR_ACCOUNT_DISCRIMINATOR(Name) ANCHOR_DISCRIMINATOR("account", Name)
@@ -41,8 +41,10 @@ public:
 
 	static TArray<uint8> DeriveSeed(const FString& mnemonic);
 
+	// Random words for 12, 15, 18, 21 or 24 words, empty for any other count.
 	static FString GenerateSentence(int wordCount);
-	static TArray<uint8> GenerateEntropy();
+	// EntropySize random bytes followed by the first byte of their SHA-256.
+	static TArray<uint8> GenerateEntropy(int32 EntropySize = 32);
 
 	static bool IsMnemonic(const FString& MnemonicString);
 };
@@ -0,0 +1,87 @@
+/*
+Copyright 2022 ATMTA, Inc.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+	http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * FPublicKey
+ *
+ * A 32 byte Solana address stored inline. Keys are decoded from base58 once, when they enter the program,
+ * and are compared and hashed as raw bytes from then on. The base58 form is only produced on demand; keys hold
+ * nothing else, so they stay 32 bytes in arrays and can be read from any thread.
+ */
+struct FPublicKey
+{
+	static constexpr int32 Size = 32;
+
+	// Longest base58 representation of 32 bytes.
+	static constexpr int32 MaxBase58Size = 44;
+
+	constexpr FPublicKey()
+		: Bytes{}
+	{
+	}
+
+	constexpr FPublicKey(const uint8 (&InBytes)[Size])
+		: Bytes{}
+	{
+		for (int32 Index = 0; Index < Size; ++Index) { Bytes[Index] = InBytes[Index]; }
+	}
+
+	FOUNDATION_API FPublicKey(const uint8* InBytes, int32 Len);
+	FOUNDATION_API explicit FPublicKey(const TArray<uint8>& InBytes);
+	FOUNDATION_API explicit FPublicKey(const FString& Base58);
+
+	// Decodes a base58 key, returns false if the string is not a valid 32 byte key.
+	FOUNDATION_API static bool FromBase58(const FString& Base58, FPublicKey& OutKey);
+
+	constexpr const uint8* GetData() const { return Bytes; }
+	constexpr int32        Num() const { return Size; }
+
+	TArray<uint8> ToBytes() const { return TArray<uint8>(Bytes, Size); }
+
+	// Base58 representation, encoded on every call.
+	FOUNDATION_API FString ToBase58() const;
+	FString ToString() const { return ToBase58(); }
+
+	constexpr bool IsZero() const
+	{
+		for (int32 Index = 0; Index < Size; ++Index)
+		{
+			if (Bytes[Index] != 0) { return false; }
+		}
+		return true;
+	}
+
+	bool operator==(const FPublicKey& Other) const { return FMemory::Memcmp(Bytes, Other.Bytes, Size) == 0; }
+	bool operator!=(const FPublicKey& Other) const { return !(*this == Other); }
+
+	// Keys are hashes or curve points, so folding the words together is a well distributed hash.
+	friend uint32 GetTypeHash(const FPublicKey& Key)
+	{
+		uint64 Words[4];
+		FMemory::Memcpy(Words, Key.Bytes, Size);
+		const uint64 Folded = Words[0] ^ (Words[1] * 0x9E3779B97F4A7C15ull) ^ (Words[2] >> 7 | Words[2] << 57) ^ Words[3];
+		return static_cast<uint32>(Folded ^ (Folded >> 32));
+	}
+
+private:
+	uint8 Bytes[Size];
+};
+
+// Arrays of keys are read and written as contiguous bytes.
+static_assert(sizeof(FPublicKey) == FPublicKey::Size);
@@ -0,0 +1,235 @@
+/*
+Copyright 2022 ATMTA, Inc.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+	http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+#pragma once
+
+#include "CoreMinimal.h"
+#include "SolanaUtils/PublicKey.h"
+
+/**
+ * FByteWriter
+ *
+ * Writes wire format values straight into a caller owned buffer. Nothing is allocated, the caller sizes the
+ * buffer up front (see CompactU16Size) and overruns are caught by check().
+ */
+class FByteWriter
+{
+public:
+	FByteWriter(uint8* InData, int32 InCapacity)
+		: Data(InData)
+		, Capacity(InCapacity)
+	{
+	}
+
+	explicit FByteWriter(TArrayView<uint8> InBuffer)
+		: FByteWriter(InBuffer.GetData(), InBuffer.Num())
+	{
+	}
+
+	// Number of bytes WriteCompactU16 produces for Value.
+	static constexpr int32 CompactU16Size(int32 Value) { return Value < 0x80 ? 1 : Value < 0x4000 ? 2 : 3; }
+
+	void WriteU8(uint8 Value) { *Reserve(1) = Value; }
+
+	void WriteU16LE(uint16 Value) { WriteLE(Value, 2); }
+	void WriteU32LE(uint32 Value) { WriteLE(Value, 4); }
+	void WriteU64LE(uint64 Value) { WriteLE(Value, 8); }
+
+	void WriteU32BE(uint32 Value) { WriteBE(Value, 4); }
+	void WriteU64BE(uint64 Value) { WriteBE(Value, 8); }
+
+	// Solana's short vector length prefix, 7 bits per byte with a continuation bit.
+	void WriteCompactU16(int32 Value)
+	{
+		check(Value >= 0 && Value <= 0xFFFF);
+		while (Value >= 0x80)
+		{
+			WriteU8(static_cast<uint8>(Value & 0x7F) | 0x80);
+			Value >>= 7;
+		}
+		WriteU8(static_cast<uint8>(Value));
+	}
+
+	void WriteBytes(const uint8* Bytes, int32 Num)
+	{
+		if (Num > 0) { FMemory::Memcpy(Reserve(Num), Bytes, Num); }
+	}
+
+	void WriteBytes(TConstArrayView<uint8> Bytes) { WriteBytes(Bytes.GetData(), Bytes.Num()); }
+
+	void WriteKey(const FPublicKey& Key) { WriteBytes(Key.GetData(), FPublicKey::Size); }
+
+	// Zero fills Num bytes and returns them, e.g. signature slots that are filled in once the message is written.
+	uint8* WriteZeroes(int32 Num)
+	{
+		uint8* Bytes = Reserve(Num);
+		FMemory::Memzero(Bytes, Num);
+		return Bytes;
+	}
+
+	// Advances past Num bytes and returns them for the caller to fill.
+	uint8* Reserve(int32 Num)
+	{
+		check(Num >= 0 && Offset + Num <= Capacity);
+		uint8* Bytes = Data + Offset;
+		Offset += Num;
+		return Bytes;
+	}
+
+	uint8* GetData() const { return Data; }
+	int32  Tell() const { return Offset; }
+	int32  Remaining() const { return Capacity - Offset; }
+
+private:
+	void WriteLE(uint64 Value, int32 Num)
+	{
+		uint8* Bytes = Reserve(Num);
+		for (int32 i = 0; i < Num; i++) { Bytes[i] = static_cast<uint8>(Value >> (i * 8)); }
+	}
+
+	void WriteBE(uint64 Value, int32 Num)
+	{
+		uint8* Bytes = Reserve(Num);
+		for (int32 i = 0; i < Num; i++) { Bytes[i] = static_cast<uint8>(Value >> ((Num - 1 - i) * 8)); }
+	}
+
+	uint8* Data;
+	int32  Capacity;
+	int32  Offset = 0;
+};
+
+/**
+ * FByteReader
+ *
+ * Reads wire format values from a borrowed buffer. Input is untrusted, so every read reports failure instead of
+ * running past the end, and compact-u16 values must use their shortest encoding.
+ */
+class FByteReader
+{
+public:
+	FByteReader(const uint8* InData, int32 InSize)
+		: Data(InData)
+		, Size(InSize)
+	{
+	}
+
+	explicit FByteReader(TConstArrayView<uint8> InBuffer)
+		: FByteReader(InBuffer.GetData(), InBuffer.Num())
+	{
+	}
+
+	bool ReadU8(uint8& OutValue)
+	{
+		const uint8* Bytes = Consume(1);
+		if (!Bytes) { return false; }
+		OutValue = *Bytes;
+		return true;
+	}
+
+	bool ReadU16LE(uint16& OutValue) { return ReadLE(OutValue, 2); }
+	bool ReadU32LE(uint32& OutValue) { return ReadLE(OutValue, 4); }
+	bool ReadU64LE(uint64& OutValue) { return ReadLE(OutValue, 8); }
+
+	bool ReadU32BE(uint32& OutValue) { return ReadBE(OutValue, 4); }
+	bool ReadU64BE(uint64& OutValue) { return ReadBE(OutValue, 8); }
+
+	bool ReadCompactU16(int32& OutValue)
+	{
+		int32 Value = 0;
+		for (int32 i = 0; i < 3; i++)
+		{
+			uint8 Byte;
+			if (!ReadU8(Byte)) { return false; }
+
+			// The third byte only carries the top two bits, and a trailing zero byte is not canonical.
+			if ((i == 2 && Byte > 0x03) || (i > 0 && Byte == 0)) { return false; }
+
+			Value |= (Byte & 0x7F) << (i * 7);
+			if ((Byte & 0x80) == 0)
+			{
+				OutValue = Value;
+				return true;
+			}
+		}
+		return false;
+	}
+
+	bool ReadBytes(uint8* OutBytes, int32 Num)
+	{
+		const uint8* Bytes = Consume(Num);
+		if (!Bytes) { return false; }
+		if (Num > 0) { FMemory::Memcpy(OutBytes, Bytes, Num); }
+		return true;
+	}
+
+	// Borrows Num bytes from the buffer without copying them.
+	bool ReadView(int32 Num, TConstArrayView<uint8>& OutView)
+	{
+		const uint8* Bytes = Consume(Num);
+		if (!Bytes) { return false; }
+		OutView = TConstArrayView<uint8>(Bytes, Num);
+		return true;
+	}
+
+	bool ReadKey(FPublicKey& OutKey)
+	{
+		const uint8* Bytes = Consume(FPublicKey::Size);
+		if (!Bytes) { return false; }
+		OutKey = FPublicKey(Bytes, FPublicKey::Size);
+		return true;
+	}
+
+	bool Skip(int32 Num) { return Consume(Num) != nullptr; }
+
+	const uint8* GetData() const { return Data; }
+	int32        Tell() const { return Offset; }
+	int32        Remaining() const { return Size - Offset; }
+	bool         IsAtEnd() const { return Offset == Size; }
+
+private:
+	const uint8* Consume(int32 Num)
+	{
+		if (Num < 0 || Num > Size - Offset) { return nullptr; }
+		const uint8* Bytes = Data + Offset;
+		Offset += Num;
+		return Bytes;
+	}
+
+	template <typename T>
+	bool ReadLE(T& OutValue, int32 Num)
+	{
+		const uint8* Bytes = Consume(Num);
+		if (!Bytes) { return false; }
+		uint64 Value = 0;
+		for (int32 i = 0; i < Num; i++) { Value |= static_cast<uint64>(Bytes[i]) << (i * 8); }
+		OutValue = static_cast<T>(Value);
+		return true;
+	}
+
+	template <typename T>
+	bool ReadBE(T& OutValue, int32 Num)
+	{
+		const uint8* Bytes = Consume(Num);
+		if (!Bytes) { return false; }
+		uint64 Value = 0;
+		for (int32 i = 0; i < Num; i++) { Value = Value << 8 | Bytes[i]; }
+		OutValue = static_cast<T>(Value);
+		return true;
+	}
+
+	const uint8* Data;
+	int32        Size;
+	int32        Offset = 0;
+};
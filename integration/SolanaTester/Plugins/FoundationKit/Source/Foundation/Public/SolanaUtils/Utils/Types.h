@@ -84,6 +84,8 @@ struct FProgramAccountJson
 {
 	GENERATED_BODY()
 
+	UPROPERTY()
+	FString pubkey;
 	UPROPERTY()
 	FString data;
 	UPROPERTY()
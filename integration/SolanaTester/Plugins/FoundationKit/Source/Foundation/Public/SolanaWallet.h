@@ -24,6 +24,7 @@ Contributers: Riccardo Torrisi, Federico Arona
 #include "SolanaWallet.generated.h"
 
 class UWalletAccount;
+class FBip39DerivationCache;
 
 /**
  * FDerivationPath
@@ -277,6 +278,9 @@ private:
 
 	FMnemonic Mnemonic;
 
+	// Nodes derived from Mnemonic, wiped when the wallet locks.
+	TSharedPtr<FBip39DerivationCache> DerivationCache;
+
 	UPROPERTY()
 	TMap<FString, UWalletAccount*> Accounts;
 
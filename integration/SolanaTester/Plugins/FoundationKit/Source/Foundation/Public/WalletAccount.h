@@ -63,7 +63,7 @@ public:
 	FString GetAccountName() const { return AccountData.Name; }
 
 	UFUNCTION(BlueprintPure)
-	FString GetPublicKey() const { return AccountData.PublicKey; }
+	FString GetPublicKey() const { return AccountData.GetPublicKeyString(); }
 
 	UFUNCTION(BlueprintCallable)
 	void SetAccountName(const FString& Name);
@@ -1,14 +1,6 @@
 #include "Solana/AccountMeta.h"
 
-#include "Crypto/Base58.h"
-
-FAccountMeta::FAccountMeta(FPublicKey InKey, bool InIsSigner, bool InIsWriteable)
-	: Key(InKey)
-	, IsSigner(InIsSigner)
-	, IsWritable(InIsWriteable) {}
-
-
-FAccountMeta::FAccountMeta(TArray<uint8> InKeyData, bool InIsSigner, bool InIsWriteable)
-	: Key(FBase58::EncodeBase58(InKeyData))
+FAccountMeta::FAccountMeta(const TArray<uint8>& InKeyData, bool InIsSigner, bool InIsWriteable)
+	: Key(InKeyData)
 	, IsSigner(InIsSigner)
 	, IsWritable(InIsWriteable) {}
\ No newline at end of file
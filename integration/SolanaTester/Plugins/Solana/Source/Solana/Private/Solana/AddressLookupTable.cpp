@@ -0,0 +1,177 @@
+#include "Solana/AddressLookupTable.h"
+
+#include "Crypto/ProgramDerivedAccount.h"
+#include "Dom/JsonObject.h"
+#include "Misc/Base64.h"
+#include "Network/RequestManager.h"
+#include "Network/RequestUtils.h"
+#include "Solana/SystemProgram.h"
+#include "SolanaUtils/Utils/ByteCursor.h"
+#include "SolanaUtils/Utils/Types.h"
+
+// Account data starts with a 56 byte LookupTableMeta, the addresses follow.
+constexpr int32  LookupTableMetaSize = 56;
+constexpr uint32 LookupTableStateTag = 1;
+constexpr int32  MaxLookupTableAddresses = 256;
+
+constexpr uint32 CreateLookupTableIndex = 0;
+constexpr uint32 ExtendLookupTableIndex = 2;
+
+// AddressLookupTab1e1111111111111111111111111
+const FPublicKey FAddressLookupTableProgram::ProgramId = FPublicKey({ 2, 119, 166, 175, 151, 51, 155, 122, 200, 141, 24, 146, 201, 4, 70,
+	245, 0, 2, 48, 146, 102, 246, 46, 83, 193, 24, 36, 73, 130, 0, 0, 0 });
+
+FAddressLookupTableAccount::FAddressLookupTableAccount(const FPublicKey& InKey, const TArray<FPublicKey>& InAddresses)
+	: Key(InKey)
+	, Addresses(InAddresses)
+{
+	AddressIndices.Reserve(Addresses.Num());
+	for (int32 i = 0; i < Addresses.Num() && i < MaxLookupTableAddresses; i++) { AddressIndices.FindOrAdd(Addresses[i], static_cast<uint8>(i)); }
+}
+
+bool FAddressLookupTableAccount::Deserialize(const FPublicKey& InKey, const TArray<uint8>& Data, FAddressLookupTableAccount& OutTable)
+{
+	FByteReader Reader(Data);
+	uint32      StateTag = 0;
+	uint64      InDeactivationSlot = 0;
+	if (Data.Num() < LookupTableMetaSize || !Reader.ReadU32LE(StateTag) || StateTag != LookupTableStateTag
+		|| !Reader.ReadU64LE(InDeactivationSlot) || (Data.Num() - LookupTableMetaSize) % FPublicKey::Size != 0)
+	{
+		UE_LOG(LogTemp, Error, TEXT("%s is not an address lookup table"), *InKey.ToBase58());
+		return false;
+	}
+
+	const int32        AddressCount = (Data.Num() - LookupTableMetaSize) / FPublicKey::Size;
+	TArray<FPublicKey> InAddresses;
+	InAddresses.Reserve(AddressCount);
+	for (int32 i = 0; i < AddressCount; i++)
+	{
+		InAddresses.Add(FPublicKey(Data.GetData() + LookupTableMetaSize + i * FPublicKey::Size, FPublicKey::Size));
+	}
+
+	OutTable = FAddressLookupTableAccount(InKey, InAddresses);
+	OutTable.DeactivationSlot = InDeactivationSlot;
+	return true;
+}
+
+int32 FAddressLookupTableAccount::IndexOf(const FPublicKey& Address) const
+{
+	const uint8* Index = AddressIndices.Find(Address);
+	return Index ? *Index : INDEX_NONE;
+}
+
+FInstruction FAddressLookupTableProgram::CreateLookupTable(const FPublicKey& Authority, const FPublicKey& Payer, uint64 RecentSlot,
+	FPublicKey& OutTableAddress)
+{
+	TArray<uint8> SlotSeed;
+	SlotSeed.AddUninitialized(sizeof(uint64));
+	FByteWriter(SlotSeed).WriteU64LE(RecentSlot);
+
+	TArray<TArray<uint8>> Seeds;
+	Seeds.Add(Authority.ToBytes());
+	Seeds.Add(SlotSeed);
+
+	const FProgramAddress Address = FProgramDerivedAccount::FindProgramAddress(Seeds, ProgramId);
+	OutTableAddress = Address.Address;
+
+	FInstruction Instruction;
+	Instruction.ProgramId = ProgramId;
+	Instruction.Accounts.Add(FAccountMeta(OutTableAddress, false, true));
+	Instruction.Accounts.Add(FAccountMeta(Authority, true, false));
+	Instruction.Accounts.Add(FAccountMeta(Payer, true, true));
+	Instruction.Accounts.Add(FAccountMeta(FSystemProgram::ProgramId, false, false));
+
+	Instruction.Data.AddUninitialized(13);
+	FByteWriter Writer(Instruction.Data);
+	Writer.WriteU32LE(CreateLookupTableIndex);
+	Writer.WriteU64LE(RecentSlot);
+	Writer.WriteU8(static_cast<uint8>(Address.Bump));
+	return Instruction;
+}
+
+FInstruction FAddressLookupTableProgram::ExtendLookupTable(const FPublicKey& Table, const FPublicKey& Authority, const FPublicKey& Payer,
+	const TArray<FPublicKey>& NewAddresses)
+{
+	FInstruction Instruction;
+	Instruction.ProgramId = ProgramId;
+	Instruction.Accounts.Add(FAccountMeta(Table, false, true));
+	Instruction.Accounts.Add(FAccountMeta(Authority, true, false));
+	Instruction.Accounts.Add(FAccountMeta(Payer, true, true));
+	Instruction.Accounts.Add(FAccountMeta(FSystemProgram::ProgramId, false, false));
+
+	Instruction.Data.AddUninitialized(12 + NewAddresses.Num() * FPublicKey::Size);
+	FByteWriter Writer(Instruction.Data);
+	Writer.WriteU32LE(ExtendLookupTableIndex);
+	Writer.WriteU64LE(NewAddresses.Num());
+	for (const FPublicKey& Address : NewAddresses) { Writer.WriteKey(Address); }
+	return Instruction;
+}
+
+FAddressLookupTableCache& FAddressLookupTableCache::Get()
+{
+	static FAddressLookupTableCache Instance;
+	return Instance;
+}
+
+void FAddressLookupTableCache::Add(const FAddressLookupTableAccount& Table)
+{
+	FScopeLock ScopeLock(&Lock);
+	Tables.Add(Table.GetKey(), Table);
+}
+
+void FAddressLookupTableCache::Remove(const FPublicKey& TableKey)
+{
+	FScopeLock ScopeLock(&Lock);
+	Tables.Remove(TableKey);
+}
+
+bool FAddressLookupTableCache::Find(const FPublicKey& TableKey, FAddressLookupTableAccount& OutTable) const
+{
+	FScopeLock ScopeLock(&Lock);
+	if (const FAddressLookupTableAccount* Table = Tables.Find(TableKey))
+	{
+		OutTable = *Table;
+		return true;
+	}
+	return false;
+}
+
+void FAddressLookupTableCache::Fetch(const FPublicKey& TableKey, TFunction<void(const FAddressLookupTableAccount*)> OnLoaded)
+{
+	FAddressLookupTableAccount Cached;
+	if (Find(TableKey, Cached))
+	{
+		OnLoaded(&Cached);
+		return;
+	}
+
+	const auto Request = FRequestUtils::RequestAccountInfo(TableKey.ToBase58(), ERequestEncoding::Base64);
+	Request->Callback.BindLambda([this, TableKey, OnLoaded](FJsonObject& Data)
+	{
+		const TSharedPtr<FJsonObject>*        Result;
+		const TSharedPtr<FJsonObject>*        Value;
+		const TArray<TSharedPtr<FJsonValue>>* AccountData;
+
+		TArray<uint8> Bytes;
+		if (!Data.TryGetObjectField(TEXT("result"), Result) || !(*Result)->TryGetObjectField(TEXT("value"), Value)
+			|| !(*Value)->TryGetArrayField(TEXT("data"), AccountData) || AccountData->IsEmpty()
+			|| !FBase64::Decode((*AccountData)[0]->AsString(), Bytes))
+		{
+			UE_LOG(LogTemp, Error, TEXT("Address lookup table %s not found"), *TableKey.ToBase58());
+			OnLoaded(nullptr);
+			return;
+		}
+
+		FAddressLookupTableAccount Table;
+		if (!FAddressLookupTableAccount::Deserialize(TableKey, Bytes, Table))
+		{
+			OnLoaded(nullptr);
+			return;
+		}
+
+		Add(Table);
+		OnLoaded(&Table);
+	});
+	Request->ErrorCallback.BindLambda([OnLoaded](FString& Error) { OnLoaded(nullptr); });
+	FRequestManager::SendRequest(Request);
+}
@@ -0,0 +1,224 @@
+#include "Solana/ComputeBudgetProgram.h"
+
+#include "Misc/Base64.h"
+#include "Network/RequestManager.h"
+#include "Network/RequestUtils.h"
+#include "Solana/Transaction.h"
+#include "SolanaUtils/Utils/ByteCursor.h"
+#include "SolanaUtils/Utils/Types.h"
+
+// Data bytes of an instruction that go into its shape, the discriminator of Anchor instructions.
+constexpr int32 ShapeDataPrefixSize = 8;
+
+// ComputeBudget111111111111111111111111111111
+const FPublicKey FComputeBudgetProgram::ProgramId = FPublicKey({ 3, 6, 70, 111, 229, 33, 23, 50, 255, 236, 173, 186, 114, 195, 155, 231,
+	188, 140, 229, 187, 197, 247, 18, 107, 44, 67, 155, 58, 64, 0, 0, 0 });
+
+namespace
+{
+	template <typename T>
+	FInstruction MakeComputeBudgetInstruction(EComputeBudgetInstructionIndex Index, T Value)
+	{
+		FInstruction Instruction;
+		Instruction.ProgramId = FComputeBudgetProgram::ProgramId;
+
+		Instruction.Data.AddUninitialized(1 + sizeof(T));
+		FByteWriter Writer(Instruction.Data);
+		Writer.WriteU8(static_cast<uint8>(Index));
+		if constexpr (sizeof(T) == sizeof(uint64)) { Writer.WriteU64LE(Value); }
+		else { Writer.WriteU32LE(Value); }
+		return Instruction;
+	}
+} // namespace
+
+FInstruction FComputeBudgetProgram::SetComputeUnitLimit(uint32 Units)
+{
+	return MakeComputeBudgetInstruction(EComputeBudgetInstructionIndex::SetComputeUnitLimit, Units);
+}
+
+FInstruction FComputeBudgetProgram::SetComputeUnitPrice(uint64 MicroLamports)
+{
+	return MakeComputeBudgetInstruction(EComputeBudgetInstructionIndex::SetComputeUnitPrice, MicroLamports);
+}
+
+FInstruction FComputeBudgetProgram::RequestHeapFrame(uint32 Bytes)
+{
+	return MakeComputeBudgetInstruction(EComputeBudgetInstructionIndex::RequestHeapFrame, Bytes);
+}
+
+FComputeBudgetOptimizer& FComputeBudgetOptimizer::Get()
+{
+	static FComputeBudgetOptimizer Instance;
+	return Instance;
+}
+
+void FComputeBudgetOptimizer::SetSafetyMargin(float Margin)
+{
+	FScopeLock ScopeLock(&Lock);
+	SafetyMargin = FMath::Max(Margin, 0.f);
+}
+
+void FComputeBudgetOptimizer::SetComputeUnitPrice(uint64 MicroLamports)
+{
+	FScopeLock ScopeLock(&Lock);
+	ComputeUnitPrice = MicroLamports;
+}
+
+void FComputeBudgetOptimizer::Optimize(const TArray<FInstruction>& Instructions, const TArray<FPublicKey>& Signers,
+	TFunction<void(const TArray<FInstruction>*)> OnReady)
+{
+	TArray<FInstruction> Optimized;
+	if (TryOptimize(Instructions, Optimized))
+	{
+		OnReady(&Optimized);
+		return;
+	}
+
+	const FString Shape = GetShapeKey(Instructions);
+	bool          bSimulate;
+	{
+		FScopeLock ScopeLock(&Lock);
+		TArray<TFunction<void(const uint32*)>>* ShapeWaiters = Waiters.Find(Shape);
+		bSimulate = ShapeWaiters == nullptr;
+		if (bSimulate) { ShapeWaiters = &Waiters.Add(Shape); }
+
+		ShapeWaiters->Add([this, Instructions, OnReady](const uint32* Units)
+		{
+			if (!Units)
+			{
+				OnReady(nullptr);
+				return;
+			}
+
+			TArray<FInstruction> Result;
+			Prepend(*Units, Instructions, Result);
+			OnReady(&Result);
+		});
+	}
+	if (!bSimulate) { return; }
+
+	// Simulated with the largest limit so the consumption is never cut short, the blockhash is replaced by the node.
+	TArray<FInstruction> Simulated;
+	Prepend(FComputeBudgetProgram::MaxComputeUnitLimit, Instructions, Simulated);
+
+	FTransaction Transaction(FPublicKey().ToBase58());
+	Transaction.AddInstructions(Simulated);
+
+	FPartiallySignedTransaction Unsigned;
+	if (!Transaction.BuildUnsigned(Signers, Unsigned))
+	{
+		OnSimulated(Shape, nullptr);
+		return;
+	}
+
+	const FString Encoded = FBase64::Encode(Unsigned.GetBytes());
+
+	FSimulateFunc Simulate;
+	{
+		FScopeLock ScopeLock(&Lock);
+		Simulate = Simulator;
+	}
+	if (Simulate)
+	{
+		Simulate(Encoded, [this, Shape](const uint64* UnitsConsumed) { OnSimulated(Shape, UnitsConsumed); });
+		return;
+	}
+
+	const auto Request = FRequestUtils::SimulateTransaction(Encoded);
+	Request->Callback.BindLambda([this, Shape](FJsonObject& Data)
+	{
+		uint64 UnitsConsumed;
+		OnSimulated(Shape, FRequestUtils::ParseSimulateTransactionResponse(Data, UnitsConsumed) ? &UnitsConsumed : nullptr);
+	});
+	Request->ErrorCallback.BindLambda([this, Shape](FString& Error) { OnSimulated(Shape, nullptr); });
+	FRequestManager::SendRequest(Request);
+}
+
+bool FComputeBudgetOptimizer::TryOptimize(const TArray<FInstruction>& Instructions, TArray<FInstruction>& OutInstructions) const
+{
+	uint32 Units;
+	if (!FindComputeUnitLimit(Instructions, Units)) { return false; }
+
+	Prepend(Units, Instructions, OutInstructions);
+	return true;
+}
+
+bool FComputeBudgetOptimizer::FindComputeUnitLimit(const TArray<FInstruction>& Instructions, uint32& OutUnits) const
+{
+	const FString Shape = GetShapeKey(Instructions);
+
+	FScopeLock ScopeLock(&Lock);
+	if (const uint32* Units = Limits.Find(Shape))
+	{
+		OutUnits = *Units;
+		return true;
+	}
+	return false;
+}
+
+void FComputeBudgetOptimizer::Reset()
+{
+	FScopeLock ScopeLock(&Lock);
+	Limits.Reset();
+}
+
+void FComputeBudgetOptimizer::SetSimulator(FSimulateFunc InSimulator)
+{
+	FScopeLock ScopeLock(&Lock);
+	Simulator = MoveTemp(InSimulator);
+}
+
+FString FComputeBudgetOptimizer::GetShapeKey(const TArray<FInstruction>& Instructions)
+{
+	TArray<uint8> Shape;
+	for (const FInstruction& Instruction : Instructions)
+	{
+		if (FComputeBudgetProgram::IsComputeBudgetInstruction(Instruction)) { continue; }
+
+		const int32 PrefixSize = FMath::Min(Instruction.Data.Num(), ShapeDataPrefixSize);
+		const int32 Offset = Shape.AddUninitialized(FPublicKey::Size + Instruction.Accounts.Num() + 2 * sizeof(uint32) + PrefixSize);
+
+		FByteWriter Writer(TArrayView<uint8>(Shape.GetData() + Offset, Shape.Num() - Offset));
+		Writer.WriteKey(Instruction.ProgramId);
+		Writer.WriteU32LE(Instruction.Accounts.Num());
+		for (const FAccountMeta& Account : Instruction.Accounts) { Writer.WriteU8(static_cast<uint8>(Account.IsSigner | Account.IsWritable << 1)); }
+		Writer.WriteU32LE(Instruction.Data.Num());
+		Writer.WriteBytes(Instruction.Data.GetData(), PrefixSize);
+	}
+	return BytesToHex(Shape.GetData(), Shape.Num());
+}
+
+void FComputeBudgetOptimizer::Prepend(uint32 Units, const TArray<FInstruction>& Instructions, TArray<FInstruction>& OutInstructions) const
+{
+	uint64 Price;
+	{
+		FScopeLock ScopeLock(&Lock);
+		Price = ComputeUnitPrice;
+	}
+
+	OutInstructions.Reset(Instructions.Num() + 2);
+	OutInstructions.Add(FComputeBudgetProgram::SetComputeUnitLimit(Units));
+	if (Price > 0) { OutInstructions.Add(FComputeBudgetProgram::SetComputeUnitPrice(Price)); }
+	for (const FInstruction& Instruction : Instructions)
+	{
+		if (!FComputeBudgetProgram::IsComputeBudgetInstruction(Instruction)) { OutInstructions.Add(Instruction); }
+	}
+}
+
+void FComputeBudgetOptimizer::OnSimulated(const FString& Shape, const uint64* UnitsConsumed)
+{
+	TArray<TFunction<void(const uint32*)>> Ready;
+	uint32                                 Units = 0;
+	{
+		FScopeLock ScopeLock(&Lock);
+		if (UnitsConsumed)
+		{
+			const uint64 WithMargin = FMath::CeilToInt64(*UnitsConsumed * (1.0 + SafetyMargin));
+			Units = static_cast<uint32>(FMath::Min<uint64>(WithMargin, FComputeBudgetProgram::MaxComputeUnitLimit));
+			Limits.Add(Shape, Units);
+		}
+		Waiters.RemoveAndCopyValue(Shape, Ready);
+	}
+
+	for (const TFunction<void(const uint32*)>& OnLimit : Ready) { OnLimit(UnitsConsumed ? &Units : nullptr); }
+}
@@ -1,41 +0,0 @@
-﻿/*
-Copyright 2022 ATMTA, Inc.
-
-Licensed under the Apache License, Version 2.0 (the "License");
-you may not use this file except in compliance with the License.
-You may obtain a copy of the License at
-
-	http://www.apache.org/licenses/LICENSE-2.0
-
-Unless required by applicable law or agreed to in writing, software
-distributed under the License is distributed on an "AS IS" BASIS,
-WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
-See the License for the specific language governing permissions and
-limitations under the License.
-
-Author: Jon Sawler
-Contributers: Daniele Calanna
-*/
-#pragma once
-
-struct Bip39KeyPair
-{
-	TArray<uint8> MasterKey;
-	TArray<uint8> ChainCode;
-};
-
-class FEd25519Bip39
-{
-public:
-
-	FEd25519Bip39(const TArray<uint8>& seed);
-
-	TArray<uint8> DeriveAccountPath(uint32 index);
-	TArray<uint8> DeriveAccountPath(const TArray<uint32>& Segments);
-
-	Bip39KeyPair KeyPair;
-
-private:
-
-	Bip39KeyPair GetChildKeyDerivation(const TArray<uint8>& key, const TArray<uint8>& chainCode, uint32 index);
-};
@@ -0,0 +1,207 @@
+#include "Solana/InstructionPacker.h"
+
+#include "Solana/Transaction.h"
+#include "SolanaUtils/Utils/ByteCursor.h"
+
+namespace
+{
+	// Serialized size of a signed legacy transaction, from the totals FTransactionBin keeps.
+	int32 GetTransactionSize(int32 KeyCount, int32 SignerCount, int32 InstructionCount, int32 InstructionBytes)
+	{
+		return FByteWriter::CompactU16Size(SignerCount) + SignerCount * FPartiallySignedTransaction::SignatureSize + 3
+			+ FByteWriter::CompactU16Size(KeyCount) + KeyCount * FPublicKey::Size + FPublicKey::Size
+			+ FByteWriter::CompactU16Size(InstructionCount) + InstructionBytes;
+	}
+
+	/**
+	 * The distinct keys of an instruction, program id included, with merged signer flags, and the bytes its compiled form
+	 * takes in the message.
+	 */
+	struct FInstructionFootprint
+	{
+		TArray<FPublicKey> Keys;
+		TArray<bool>       IsSigner;
+		int32              Bytes = 0;
+
+		explicit FInstructionFootprint(const FInstruction& Instruction)
+		{
+			Keys.Reserve(Instruction.Accounts.Num() + 1);
+			IsSigner.Reserve(Instruction.Accounts.Num() + 1);
+
+			AddKey(Instruction.ProgramId, false);
+			for (const FAccountMeta& Account : Instruction.Accounts) { AddKey(Account.Key, Account.IsSigner); }
+
+			Bytes = 1 + FByteWriter::CompactU16Size(Instruction.Accounts.Num()) + Instruction.Accounts.Num()
+				+ FByteWriter::CompactU16Size(Instruction.Data.Num()) + Instruction.Data.Num();
+		}
+
+		// Rough cost in an empty transaction, to pack the largest groups first.
+		int32 GetWeight() const
+		{
+			int32 Weight = Bytes + Keys.Num() * FPublicKey::Size;
+			for (const bool Signs : IsSigner) { Weight += Signs ? FPartiallySignedTransaction::SignatureSize : 0; }
+			return Weight;
+		}
+
+	private:
+		void AddKey(const FPublicKey& Key, bool Signs)
+		{
+			const int32 Index = Keys.Find(Key);
+			if (Index == INDEX_NONE)
+			{
+				Keys.Add(Key);
+				IsSigner.Add(Signs);
+			}
+			else { IsSigner[Index] |= Signs; }
+		}
+	};
+
+	/**
+	 * A transaction being filled, tracking exactly what its serialized size would be.
+	 */
+	struct FTransactionBin
+	{
+		// Every key of the message and whether it signs.
+		TMap<FPublicKey, bool> Keys;
+		int32                  SignerCount = 0;
+		int32                  InstructionBytes = 0;
+		TArray<int32>          Instructions;
+
+		explicit FTransactionBin(const FPublicKey& FeePayer)
+		{
+			Keys.Add(FeePayer, true);
+			SignerCount = 1;
+		}
+
+		int32 GetSize() const { return GetTransactionSize(Keys.Num(), SignerCount, Instructions.Num(), InstructionBytes); }
+
+		// Adds the instruction if the transaction stays within both limits.
+		bool TryAdd(int32 InstructionIndex, const FInstructionFootprint& Footprint)
+		{
+			int32 NewKeys = 0;
+			int32 NewSigners = 0;
+			for (int32 i = 0; i < Footprint.Keys.Num(); i++)
+			{
+				const bool* Signs = Keys.Find(Footprint.Keys[i]);
+				if (!Signs) { NewKeys++; }
+				if (Footprint.IsSigner[i] && !(Signs && *Signs)) { NewSigners++; }
+			}
+
+			const int32 KeyCount = Keys.Num() + NewKeys;
+			if (KeyCount > FInstructionPacker::MaxTransactionAccounts
+				|| GetTransactionSize(KeyCount, SignerCount + NewSigners, Instructions.Num() + 1, InstructionBytes + Footprint.Bytes)
+				> FInstructionPacker::MaxTransactionSize)
+			{
+				return false;
+			}
+
+			for (int32 i = 0; i < Footprint.Keys.Num(); i++) { Keys.FindOrAdd(Footprint.Keys[i], false) |= Footprint.IsSigner[i]; }
+			SignerCount += NewSigners;
+			InstructionBytes += Footprint.Bytes;
+			Instructions.Add(InstructionIndex);
+			return true;
+		}
+	};
+} // namespace
+
+FInstructionPacker::FInstructionPacker(const TArray<FPublicKey>& InSigners)
+	: Signers(InSigners)
+{
+}
+
+void FInstructionPacker::Add(const FInstruction& Instruction)
+{
+	GroupStarts.Add(Instructions.Num());
+	Instructions.Add(Instruction);
+}
+
+void FInstructionPacker::AddGroup(const TArray<FInstruction>& Group)
+{
+	if (Group.IsEmpty()) { return; }
+
+	GroupStarts.Add(Instructions.Num());
+	Instructions.Append(Group);
+}
+
+void FInstructionPacker::Reset()
+{
+	Instructions.Reset();
+	GroupStarts.Reset();
+}
+
+bool FInstructionPacker::Pack(TArray<FPackedTransaction>& OutTransactions) const
+{
+	OutTransactions.Reset();
+	if (Signers.IsEmpty())
+	{
+		UE_LOG(LogTemp, Error, TEXT("Cannot pack instructions without a fee payer"));
+		return false;
+	}
+
+	TArray<FInstructionFootprint> Footprints;
+	Footprints.Reserve(Instructions.Num());
+	for (int32 i = 0; i < Instructions.Num(); i++)
+	{
+		const FInstructionFootprint& Footprint = Footprints.Emplace_GetRef(Instructions[i]);
+		for (int32 j = 0; j < Footprint.Keys.Num(); j++)
+		{
+			if (Footprint.IsSigner[j] && !Signers.Contains(Footprint.Keys[j]))
+			{
+				UE_LOG(LogTemp, Error, TEXT("Instruction %d must be signed by %s, which is not one of the signers"), i, *Footprint.Keys[j].ToBase58());
+				return false;
+			}
+		}
+
+		if (!FTransactionBin(Signers[0]).TryAdd(i, Footprint))
+		{
+			UE_LOG(LogTemp, Error, TEXT("Instruction %d does not fit in a transaction on its own"), i);
+			return false;
+		}
+	}
+
+	// First fit decreasing, whole groups at a time so the order constraint only ever looks forward.
+	TArray<int32> GroupOrder;
+	TArray<int32> GroupWeights;
+	GroupOrder.SetNumUninitialized(GroupStarts.Num());
+	GroupWeights.SetNumZeroed(GroupStarts.Num());
+	for (int32 Group = 0; Group < GroupStarts.Num(); Group++)
+	{
+		GroupOrder[Group] = Group;
+		const int32 End = Group + 1 < GroupStarts.Num() ? GroupStarts[Group + 1] : Instructions.Num();
+		for (int32 i = GroupStarts[Group]; i < End; i++) { GroupWeights[Group] += Footprints[i].GetWeight(); }
+	}
+	GroupOrder.StableSort([&GroupWeights](int32 A, int32 B) { return GroupWeights[A] > GroupWeights[B]; });
+
+	TArray<FTransactionBin> Bins;
+	for (const int32 Group : GroupOrder)
+	{
+		const int32 End = Group + 1 < GroupStarts.Num() ? GroupStarts[Group + 1] : Instructions.Num();
+
+		// An instruction never lands in an earlier transaction than the one before it in its group.
+		int32 FirstBin = 0;
+		for (int32 i = GroupStarts[Group]; i < End; i++)
+		{
+			while (FirstBin < Bins.Num() && !Bins[FirstBin].TryAdd(i, Footprints[i])) { FirstBin++; }
+			if (FirstBin == Bins.Num()) { verify(Bins.Emplace_GetRef(Signers[0]).TryAdd(i, Footprints[i])); }
+		}
+	}
+
+	OutTransactions.SetNum(Bins.Num());
+	for (int32 b = 0; b < Bins.Num(); b++)
+	{
+		const FTransactionBin& Bin = Bins[b];
+		FPackedTransaction&    Transaction = OutTransactions[b];
+
+		for (const FPublicKey& Signer : Signers)
+		{
+			const bool* Signs = Bin.Keys.Find(Signer);
+			if (Signs && *Signs) { Transaction.Signers.AddUnique(Signer); }
+		}
+
+		Transaction.Instructions.Reserve(Bin.Instructions.Num());
+		for (const int32 Index : Bin.Instructions) { Transaction.Instructions.Add(Instructions[Index]); }
+		Transaction.Size = Bin.GetSize();
+	}
+
+	return true;
+}
@@ -0,0 +1,365 @@
+#include "Solana/Message.h"
+
+#include "Solana/AddressLookupTable.h"
+#include "Solana/Instruction.h"
+#include "SolanaUtils/Utils/ByteCursor.h"
+
+constexpr int32 MaxAccountIndices = 256;
+constexpr uint8 VersionPrefixMask = 0x80;
+
+namespace
+{
+	struct FKeyMeta
+	{
+		bool IsSigner = false;
+		bool IsWritable = false;
+		bool IsInvoked = false;
+	};
+
+	// Header class of a key, the order in which classes appear in the account list.
+	int32 GetKeyClass(const FKeyMeta& Meta)
+	{
+		if (Meta.IsSigner) { return Meta.IsWritable ? 0 : 1; }
+		return Meta.IsWritable ? 2 : 3;
+	}
+
+	/**
+	 * Every distinct key referenced by a set of instructions, in first-seen order, with merged flags.
+	 * References holds, for each instruction, the key index of the program followed by those of its accounts.
+	 */
+	struct FCollectedKeys
+	{
+		TMap<FPublicKey, int32> KeyIndices;
+		TArray<FPublicKey>      Keys;
+		TArray<FKeyMeta>        Metas;
+		TArray<int32>           References;
+
+		void Collect(const TArray<FPublicKey>& Signers, const TArray<FInstruction>& Instructions)
+		{
+			int32 ReferenceCount = Signers.Num();
+			for (const FInstruction& Instruction : Instructions) { ReferenceCount += Instruction.Accounts.Num() + 1; }
+
+			KeyIndices.Reserve(ReferenceCount);
+			Keys.Reserve(ReferenceCount);
+			Metas.Reserve(ReferenceCount);
+			References.Reserve(ReferenceCount);
+
+			// The fee payer is always the first, writable, signer.
+			Add(Signers[0], true, true, false);
+			for (int32 i = 1; i < Signers.Num(); i++) { Add(Signers[i], true, false, false); }
+
+			// Single pass over the instructions, remembering where every reference landed.
+			for (const FInstruction& Instruction : Instructions)
+			{
+				References.Add(Add(Instruction.ProgramId, false, false, true));
+				for (const FAccountMeta& Account : Instruction.Accounts)
+				{
+					References.Add(Add(Account.Key, Account.IsSigner, Account.IsWritable, false));
+				}
+			}
+		}
+
+		int32 Add(const FPublicKey& Key, bool IsSigner, bool IsWritable, bool IsInvoked)
+		{
+			int32& Index = KeyIndices.FindOrAdd(Key, INDEX_NONE);
+			if (Index == INDEX_NONE)
+			{
+				Index = Keys.Add(Key);
+				Metas.AddDefaulted();
+			}
+			Metas[Index].IsSigner |= IsSigner;
+			Metas[Index].IsWritable |= IsWritable;
+			Metas[Index].IsInvoked |= IsInvoked;
+			return Index;
+		}
+	};
+
+	/**
+	 * Stable partition of the keys still marked INDEX_NONE in Remap into the four header classes.
+	 * Fills Remap with the final position of each of those keys.
+	 */
+	void PartitionStaticKeys(const FCollectedKeys& Collected, TArray<int32>& Remap, TArray<FPublicKey>& OutKeys, FMessageHeader& OutHeader)
+	{
+		int32 ClassCounts[4] = {};
+		for (int32 i = 0; i < Collected.Keys.Num(); i++)
+		{
+			if (Remap[i] == INDEX_NONE) { ClassCounts[GetKeyClass(Collected.Metas[i])]++; }
+		}
+
+		int32 ClassOffsets[4] = { 0, ClassCounts[0], ClassCounts[0] + ClassCounts[1], ClassCounts[0] + ClassCounts[1] + ClassCounts[2] };
+
+		OutKeys.SetNum(ClassOffsets[3] + ClassCounts[3]);
+		for (int32 i = 0; i < Collected.Keys.Num(); i++)
+		{
+			if (Remap[i] != INDEX_NONE) { continue; }
+
+			const int32 Position = ClassOffsets[GetKeyClass(Collected.Metas[i])]++;
+			Remap[i] = Position;
+			OutKeys[Position] = Collected.Keys[i];
+		}
+
+		OutHeader.NumRequiredSignatures = static_cast<uint8>(ClassCounts[0] + ClassCounts[1]);
+		OutHeader.NumReadonlySignedAccounts = static_cast<uint8>(ClassCounts[1]);
+		OutHeader.NumReadonlyUnsignedAccounts = static_cast<uint8>(ClassCounts[3]);
+	}
+
+	void CompileInstructions(const FCollectedKeys& Collected, const TArray<int32>& Remap, const TArray<FInstruction>& Instructions,
+		TArray<FCompiledInstruction>& OutInstructions)
+	{
+		OutInstructions.SetNum(Instructions.Num());
+		int32 Reference = 0;
+		for (int32 i = 0; i < Instructions.Num(); i++)
+		{
+			const FInstruction&   Instruction = Instructions[i];
+			FCompiledInstruction& Compiled = OutInstructions[i];
+
+			Compiled.ProgramIdIndex = static_cast<uint8>(Remap[Collected.References[Reference++]]);
+			Compiled.AccountIndices.SetNumUninitialized(Instruction.Accounts.Num());
+			for (int32 j = 0; j < Instruction.Accounts.Num(); j++)
+			{
+				Compiled.AccountIndices[j] = static_cast<uint8>(Remap[Collected.References[Reference++]]);
+			}
+			Compiled.Data = Instruction.Data;
+		}
+	}
+
+	constexpr int32 CompactU16Size(int32 Value) { return FByteWriter::CompactU16Size(Value); }
+
+	// Size of everything between the header and the end of the instructions, shared by both message versions.
+	int32 GetBodySize(const TArray<FPublicKey>& Keys, const TArray<FCompiledInstruction>& Instructions)
+	{
+		int32 Size = 3 + CompactU16Size(Keys.Num()) + Keys.Num() * FPublicKey::Size + FPublicKey::Size;
+		Size += CompactU16Size(Instructions.Num());
+		for (const FCompiledInstruction& Instruction : Instructions)
+		{
+			Size += 1 + CompactU16Size(Instruction.AccountIndices.Num()) + Instruction.AccountIndices.Num();
+			Size += CompactU16Size(Instruction.Data.Num()) + Instruction.Data.Num();
+		}
+		return Size;
+	}
+
+	void WriteBody(FByteWriter& Writer, const FMessageHeader& Header, const TArray<FPublicKey>& Keys, const FPublicKey& Blockhash,
+		const TArray<FCompiledInstruction>& Instructions)
+	{
+		Writer.WriteU8(Header.NumRequiredSignatures);
+		Writer.WriteU8(Header.NumReadonlySignedAccounts);
+		Writer.WriteU8(Header.NumReadonlyUnsignedAccounts);
+
+		Writer.WriteCompactU16(Keys.Num());
+		for (const FPublicKey& Key : Keys) { Writer.WriteKey(Key); }
+
+		Writer.WriteKey(Blockhash);
+
+		Writer.WriteCompactU16(Instructions.Num());
+		for (const FCompiledInstruction& Instruction : Instructions)
+		{
+			Writer.WriteU8(Instruction.ProgramIdIndex);
+			Writer.WriteCompactU16(Instruction.AccountIndices.Num());
+			Writer.WriteBytes(Instruction.AccountIndices);
+			Writer.WriteCompactU16(Instruction.Data.Num());
+			Writer.WriteBytes(Instruction.Data);
+		}
+	}
+
+	int32 FindSigner(const TArray<FPublicKey>& Keys, const FMessageHeader& Header, const FPublicKey& Key)
+	{
+		for (int32 i = 0; i < Header.NumRequiredSignatures; i++)
+		{
+			if (Keys[i] == Key) { return i; }
+		}
+		return INDEX_NONE;
+	}
+} // namespace
+
+bool FMessage::Compile(const TArray<FPublicKey>& Signers, const TArray<FInstruction>& InInstructions, const FPublicKey& InRecentBlockhash,
+	FMessage& OutMessage)
+{
+	if (Signers.IsEmpty())
+	{
+		UE_LOG(LogTemp, Error, TEXT("Cannot compile a message without a fee payer"));
+		return false;
+	}
+
+	FCollectedKeys Collected;
+	Collected.Collect(Signers, InInstructions);
+
+	if (Collected.Keys.Num() > MaxAccountIndices)
+	{
+		UE_LOG(LogTemp, Error, TEXT("Message references %d accounts, the limit is %d"), Collected.Keys.Num(), MaxAccountIndices);
+		return false;
+	}
+
+	TArray<int32> Remap;
+	Remap.Init(INDEX_NONE, Collected.Keys.Num());
+	PartitionStaticKeys(Collected, Remap, OutMessage.AccountKeys, OutMessage.Header);
+	CompileInstructions(Collected, Remap, InInstructions, OutMessage.Instructions);
+	OutMessage.RecentBlockhash = InRecentBlockhash;
+
+	return true;
+}
+
+int32 FMessage::GetSerializedSize() const
+{
+	return GetBodySize(AccountKeys, Instructions);
+}
+
+void FMessage::Serialize(TArray<uint8>& Buffer) const
+{
+	const int32 Size = GetSerializedSize();
+	const int32 Offset = Buffer.AddUninitialized(Size);
+	FByteWriter Writer(Buffer.GetData() + Offset, Size);
+	Serialize(Writer);
+	check(Writer.Remaining() == 0);
+}
+
+void FMessage::Serialize(FByteWriter& Writer) const
+{
+	WriteBody(Writer, Header, AccountKeys, RecentBlockhash, Instructions);
+}
+
+TArray<uint8> FMessage::Serialize() const
+{
+	TArray<uint8> Buffer;
+	Serialize(Buffer);
+	return Buffer;
+}
+
+int32 FMessage::GetSignerIndex(const FPublicKey& Key) const
+{
+	return FindSigner(AccountKeys, Header, Key);
+}
+
+bool FMessage::IsWritable(int32 Index) const
+{
+	if (Index < Header.NumRequiredSignatures) { return Index < Header.NumRequiredSignatures - Header.NumReadonlySignedAccounts; }
+	return Index < AccountKeys.Num() - Header.NumReadonlyUnsignedAccounts;
+}
+
+bool FMessageV0::Compile(const TArray<FPublicKey>& Signers, const TArray<FInstruction>& InInstructions, const FPublicKey& InRecentBlockhash,
+	const TArray<FAddressLookupTableAccount>& LookupTables, FMessageV0& OutMessage)
+{
+	if (Signers.IsEmpty())
+	{
+		UE_LOG(LogTemp, Error, TEXT("Cannot compile a message without a fee payer"));
+		return false;
+	}
+
+	FCollectedKeys Collected;
+	Collected.Collect(Signers, InInstructions);
+
+	// Lookup position of every key moved to a table, writable and read-only lookups are numbered separately.
+	TArray<int32> Remap;
+	Remap.Init(INDEX_NONE, Collected.Keys.Num());
+	TArray<bool> IsWritableLookup;
+	IsWritableLookup.Init(false, Collected.Keys.Num());
+
+	int32 WritableLookupCount = 0;
+	int32 ReadonlyLookupCount = 0;
+
+	OutMessage.AddressTableLookups.Reset();
+	for (const FAddressLookupTableAccount& Table : LookupTables)
+	{
+		FMessageAddressTableLookup Lookup;
+		Lookup.AccountKey = Table.GetKey();
+
+		for (int32 i = 0; i < Collected.Keys.Num(); i++)
+		{
+			const FKeyMeta& Meta = Collected.Metas[i];
+			if (Remap[i] != INDEX_NONE || Meta.IsSigner || Meta.IsInvoked) { continue; }
+
+			const int32 TableIndex = Table.IndexOf(Collected.Keys[i]);
+			if (TableIndex == INDEX_NONE) { continue; }
+
+			if (Meta.IsWritable)
+			{
+				Lookup.WritableIndexes.Add(static_cast<uint8>(TableIndex));
+				Remap[i] = WritableLookupCount++;
+				IsWritableLookup[i] = true;
+			}
+			else
+			{
+				Lookup.ReadonlyIndexes.Add(static_cast<uint8>(TableIndex));
+				Remap[i] = ReadonlyLookupCount++;
+			}
+		}
+
+		if (!Lookup.WritableIndexes.IsEmpty() || !Lookup.ReadonlyIndexes.IsEmpty()) { OutMessage.AddressTableLookups.Add(MoveTemp(Lookup)); }
+	}
+
+	// Static keys come first in the index space, so the lookup positions are resolved once their count is known.
+	TArray<int32> StaticRemap;
+	StaticRemap.Init(INDEX_NONE, Collected.Keys.Num());
+	for (int32 i = 0; i < Collected.Keys.Num(); i++)
+	{
+		if (Remap[i] != INDEX_NONE) { StaticRemap[i] = MaxAccountIndices; }
+	}
+	PartitionStaticKeys(Collected, StaticRemap, OutMessage.StaticAccountKeys, OutMessage.Header);
+
+	const int32 StaticCount = OutMessage.StaticAccountKeys.Num();
+	if (StaticCount + WritableLookupCount + ReadonlyLookupCount > MaxAccountIndices)
+	{
+		UE_LOG(LogTemp, Error, TEXT("Message addresses %d accounts, the limit is %d"), StaticCount + WritableLookupCount + ReadonlyLookupCount,
+			MaxAccountIndices);
+		return false;
+	}
+
+	for (int32 i = 0; i < Collected.Keys.Num(); i++)
+	{
+		if (Remap[i] == INDEX_NONE) { Remap[i] = StaticRemap[i]; }
+		else { Remap[i] += IsWritableLookup[i] ? StaticCount : StaticCount + WritableLookupCount; }
+	}
+
+	CompileInstructions(Collected, Remap, InInstructions, OutMessage.Instructions);
+	OutMessage.RecentBlockhash = InRecentBlockhash;
+
+	return true;
+}
+
+int32 FMessageV0::GetSerializedSize() const
+{
+	int32 Size = 1 + GetBodySize(StaticAccountKeys, Instructions) + CompactU16Size(AddressTableLookups.Num());
+	for (const FMessageAddressTableLookup& Lookup : AddressTableLookups)
+	{
+		Size += FPublicKey::Size;
+		Size += CompactU16Size(Lookup.WritableIndexes.Num()) + Lookup.WritableIndexes.Num();
+		Size += CompactU16Size(Lookup.ReadonlyIndexes.Num()) + Lookup.ReadonlyIndexes.Num();
+	}
+	return Size;
+}
+
+void FMessageV0::Serialize(TArray<uint8>& Buffer) const
+{
+	const int32 Size = GetSerializedSize();
+	const int32 Offset = Buffer.AddUninitialized(Size);
+	FByteWriter Writer(Buffer.GetData() + Offset, Size);
+	Serialize(Writer);
+	check(Writer.Remaining() == 0);
+}
+
+void FMessageV0::Serialize(FByteWriter& Writer) const
+{
+	Writer.WriteU8(VersionPrefixMask | 0);
+	WriteBody(Writer, Header, StaticAccountKeys, RecentBlockhash, Instructions);
+
+	Writer.WriteCompactU16(AddressTableLookups.Num());
+	for (const FMessageAddressTableLookup& Lookup : AddressTableLookups)
+	{
+		Writer.WriteKey(Lookup.AccountKey);
+		Writer.WriteCompactU16(Lookup.WritableIndexes.Num());
+		Writer.WriteBytes(Lookup.WritableIndexes);
+		Writer.WriteCompactU16(Lookup.ReadonlyIndexes.Num());
+		Writer.WriteBytes(Lookup.ReadonlyIndexes);
+	}
+}
+
+TArray<uint8> FMessageV0::Serialize() const
+{
+	TArray<uint8> Buffer;
+	Serialize(Buffer);
+	return Buffer;
+}
+
+int32 FMessageV0::GetSignerIndex(const FPublicKey& Key) const
+{
+	return FindSigner(StaticAccountKeys, Header, Key);
+}
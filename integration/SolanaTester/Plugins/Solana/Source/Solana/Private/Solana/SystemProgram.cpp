@@ -0,0 +1,25 @@
+#include "Solana/SystemProgram.h"
+
+#include "SolanaUtils/Utils/ByteCursor.h"
+
+constexpr uint32 AdvanceNonceAccountIndex = 4;
+
+// 11111111111111111111111111111111
+const FPublicKey FSystemProgram::ProgramId = FPublicKey();
+
+// SysvarRecentB1ockHashes11111111111111111111
+static constexpr FPublicKey RecentBlockhashesSysvar = FPublicKey({ 6, 167, 213, 23, 25, 44, 86, 142, 224, 138, 132, 95, 115, 210, 151,
+	136, 207, 3, 92, 49, 69, 178, 26, 179, 68, 216, 6, 46, 169, 64, 0, 0 });
+
+FInstruction FSystemProgram::AdvanceNonceAccount(const FPublicKey& NonceAccount, const FPublicKey& Authority)
+{
+	FInstruction Instruction;
+	Instruction.ProgramId = ProgramId;
+	Instruction.Accounts.Add(FAccountMeta(NonceAccount, false, true));
+	Instruction.Accounts.Add(FAccountMeta(RecentBlockhashesSysvar, false, false));
+	Instruction.Accounts.Add(FAccountMeta(Authority, true, false));
+
+	Instruction.Data.AddUninitialized(sizeof(uint32));
+	FByteWriter(Instruction.Data).WriteU32LE(AdvanceNonceAccountIndex);
+	return Instruction;
+}
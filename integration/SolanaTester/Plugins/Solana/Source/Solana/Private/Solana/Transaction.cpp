@@ -5,46 +5,130 @@
 **/
 
 #include "Solana/Transaction.h"
+#include "Async/ParallelFor.h"
+#include "Crypto/SignatureBatch.h"
+#include "Solana/AddressLookupTable.h"
 #include "Solana/Instruction.h"
-#include "Solana/PublicKey.h"
+#include "Solana/TransactionTemplate.h"
 #include "SolanaUtils/Account.h"
-#include "Crypto/Base58.h"
-#include "Crypto/CryptoUtils.h"
+#include "SolanaUtils/Utils/ByteCursor.h"
 
-FTransaction::FTransaction(const FString& CurrentBlockHash)
+constexpr int32 SignatureSize = FPartiallySignedTransaction::SignatureSize;
+
+namespace
 {
-	BlockHash = CurrentBlockHash;
+	/**
+	 * Signs Message with every signer on the task graph. Each signature goes straight to Signatures + slot * 64, slots
+	 * never overlap so the workers share nothing but read-only inputs.
+	 */
+	void SignIntoSlots(const TArray<FAccount>& Signers, const TArray<int32>& Slots, const uint8* Message, int32 MessageSize, uint8* Signatures)
+	{
+		ParallelFor(Signers.Num(), [&](int32 Index)
+		{
+			if (Slots[Index] != INDEX_NONE) { Signers[Index].Sign(Message, MessageSize, Signatures + Slots[Index] * SignatureSize); }
+		});
+	}
+
+	void SignAll(FPartiallySignedTransaction& Transaction, const TArray<FAccount>& Signers)
+	{
+		Transaction.Sign(Signers);
+		if (Transaction.GetSlotCount() > Signers.Num())
+		{
+			UE_LOG(LogTemp, Warning, TEXT("Transaction requires %d signatures but only %d signers were given"), Transaction.GetSlotCount(),
+				Signers.Num());
+		}
+	}
+} // namespace
 
-	RequiredSignatures = 0;
-	ReadOnlySignedAccounts = 0;
-	ReadOnlyUnsignedAccounts = 0;
+int32 FPartiallySignedTransaction::GetSlot(const FPublicKey& Key) const
+{
+	return SlotKeys.Find(Key);
 }
 
-void FTransaction::AddInstruction(const FInstruction& Instruction)
+bool FPartiallySignedTransaction::SetSignature(const FPublicKey& Key, const uint8* Signature)
 {
-	Instructions.Add(Instruction);
-	for (const FAccountMeta& data : Instruction.Accounts)
+	const int32 Slot = GetSlot(Key);
+	if (Slot == INDEX_NONE)
 	{
-		const int index = AccountList.IndexOfByPredicate([data](const FAccountMeta& entry) {
-			return data.Key.DecodeBase58() == entry.Key.DecodeBase58();
-		});
-		if (index == INDEX_NONE) { AccountList.Add(data); }
-		else { if (data.IsWritable && !AccountList[index].IsWritable) { AccountList[index] = data; } }
+		UE_LOG(LogTemp, Error, TEXT("%s does not sign this transaction"), *Key.ToBase58());
+		return false;
 	}
+
+	SetSignature(Slot, Signature);
+	return true;
 }
 
-void FTransaction::AddInstructions(const TArray<FInstruction>& InInstructions)
+void FPartiallySignedTransaction::SetSignature(int32 Slot, const uint8* Signature)
 {
-	Instructions.Append(InInstructions);
-	for (const FInstruction& Instruction : InInstructions) { AddInstruction(Instruction); }
+	check(SlotKeys.IsValidIndex(Slot));
+	FMemory::Memcpy(GetSlotData(Slot), Signature, SignatureSize);
+}
+
+void FPartiallySignedTransaction::Sign(const TArray<FAccount>& Signers)
+{
+	TArray<int32> Slots;
+	Slots.Reserve(Signers.Num());
+	for (const FAccount& Signer : Signers)
+	{
+		const int32 Slot = GetSlot(Signer.Key);
+		if (Slot == INDEX_NONE) { UE_LOG(LogTemp, Warning, TEXT("%s does not sign this transaction"), *Signer.GetPublicKeyString()); }
+
+		// A signer listed twice signs once, so no two workers write the same slot.
+		Slots.Add(Slots.Contains(Slot) ? INDEX_NONE : Slot);
+	}
+
+	SignIntoSlots(Signers, Slots, GetMessage(), GetMessageSize(), GetSlotData(0));
+}
+
+void FPartiallySignedTransaction::ClearSignatures()
+{
+	FMemory::Memzero(GetSlotData(0), SlotKeys.Num() * SignatureSize);
+}
+
+bool FPartiallySignedTransaction::IsSlotFilled(int32 Slot) const
+{
+	const uint8* Signature = GetSlotData(Slot);
+	uint8        Bits = 0;
+	for (int32 i = 0; i < SignatureSize; i++) { Bits |= Signature[i]; }
+	return Bits != 0;
+}
+
+bool FPartiallySignedTransaction::IsFullySigned() const
+{
+	for (int32 Slot = 0; Slot < SlotKeys.Num(); Slot++)
+	{
+		if (!IsSlotFilled(Slot)) { return false; }
+	}
+	return true;
+}
+
+bool FPartiallySignedTransaction::VerifySignatures() const
+{
+	FSignatureBatch Batch;
+	Batch.Reserve(SlotKeys.Num());
+	for (int32 Slot = 0; Slot < SlotKeys.Num(); Slot++)
+	{
+		if (IsSlotFilled(Slot)) { Batch.Add(GetMessage(), GetMessageSize(), GetSlotData(Slot), SlotKeys[Slot].GetData()); }
+	}
+	return Batch.VerifyStrict();
 }
 
-uint8 FTransaction::GetAccountIndex(const FPublicKey& Key) const
+FTransaction::FTransaction(const FString& CurrentBlockHash)
 {
-	return AccountList.IndexOfByPredicate([Key](const FAccountMeta& data) {
-		// TODO: Allow == on FPublicKey (resolve inheritance ambiguity) 
-		return data.Key.DecodeBase58() == Key.DecodeBase58();
-	});
+	if (!FPublicKey::FromBase58(CurrentBlockHash, BlockHash))
+	{
+		UE_LOG(LogTemp, Error, TEXT("Invalid block hash: %s"), *CurrentBlockHash);
+	}
+}
+
+void FTransaction::AddInstruction(const FInstruction& Instruction)
+{
+	Instructions.Add(Instruction);
+}
+
+void FTransaction::AddInstructions(const TArray<FInstruction>& InInstructions)
+{
+	Instructions.Append(InInstructions);
 }
 
 TArray<uint8> FTransaction::Build(const FAccount& Signer)
@@ -54,105 +138,130 @@ TArray<uint8> FTransaction::Build(const FAccount& Signer)
 	return Build(Signers);
 }
 
-TArray<uint8> FTransaction::Build(const TArray<FAccount>& Signers)
+bool FTransaction::CompileMessage(const TArray<FPublicKey>& Signers, FMessage& OutMessage) const
 {
-	UpdateAccountList(Signers);
-
-	const TArray<uint8> Message = BuildMessage();
-
-	TArray<uint8> Result = Sign(Message, Signers);
-	Result.Append(Message);
+	return FMessage::Compile(Signers, Instructions, BlockHash, OutMessage);
+}
 
-	return Result;
+TArray<FPublicKey> FTransaction::GetSignerKeys(const TArray<FAccount>& Signers)
+{
+	TArray<FPublicKey> SignerKeys;
+	SignerKeys.Reserve(Signers.Num());
+	for (const FAccount& Signer : Signers) { SignerKeys.Add(Signer.Key); }
+	return SignerKeys;
 }
 
-void FTransaction::UpdateAccountList(const TArray<FAccount>& Signers)
+template <typename MessageType>
+void FTransaction::SerializeUnsigned(const MessageType& Message, const TArray<FPublicKey>& MessageKeys,
+	FPartiallySignedTransaction& OutTransaction)
 {
-	for (const FAccount& Account : Signers)
-	{
-		int Index = 0;
-		while (Index != INDEX_NONE)
-		{
-			Index = AccountList.IndexOfByPredicate([Account](const FAccountMeta& entry) {
-				return Account.PublicKeyData == entry.Key.DecodeBase58();
-			});
-			if (Index != INDEX_NONE) { AccountList.RemoveAt(Index); }
-		}
-	}
+	// Signature count, zeroed signature slots, then the message, all in one buffer.
+	const int32 SignatureCount = Message.Header.NumRequiredSignatures;
+	const int32 MessageSize = Message.GetSerializedSize();
+	const int32 Size = FByteWriter::CompactU16Size(SignatureCount) + SignatureCount * SignatureSize + MessageSize;
+
+	// Reset keeps the allocation, so a caller reusing the transaction does not allocate for the bytes.
+	TArray<uint8>& Bytes = OutTransaction.Bytes;
+	Bytes.Reset();
+	Bytes.AddUninitialized(Size);
+
+	FByteWriter Writer(Bytes.GetData(), Size);
+	Writer.WriteCompactU16(SignatureCount);
+	OutTransaction.SignaturesOffset = Writer.Tell();
+	Writer.WriteZeroes(SignatureCount * SignatureSize);
 
-	// Sort write-ables to the top of list before reading Signers at the very top
-	AccountList.Sort([](const FAccountMeta& A, const FAccountMeta& B) { return A.IsWritable && !B.IsWritable; });
+	OutTransaction.MessageOffset = Writer.Tell();
+	Message.Serialize(Writer);
+	check(Writer.Remaining() == 0);
+
+	// Signatures follow the order of the signing keys in the message, not the order of the signers array.
+	OutTransaction.SlotKeys.Reset();
+	OutTransaction.SlotKeys.Append(MessageKeys.GetData(), SignatureCount);
+}
 
-	for (int i = 0; i < Signers.Num(); i++) { AccountList.Insert(FAccountMeta(Signers[i].PublicKeyData, true, true), i); }
+TArray<uint8> FTransaction::Build(const TArray<FAccount>& Signers)
+{
+	TArray<uint8> Transaction;
+	Build(Signers, Transaction);
+	return Transaction;
 }
 
-TArray<uint8> FTransaction::BuildMessage()
+bool FTransaction::Build(const TArray<FAccount>& Signers, TArray<uint8>& OutTransaction)
 {
-	TArray<uint8> AccountKeysBuffer;
-	for (FAccountMeta& AccountMeta : AccountList)
+	FPartiallySignedTransaction Transaction;
+	Transaction.Bytes = MoveTemp(OutTransaction);
+	if (!BuildUnsigned(GetSignerKeys(Signers), Transaction))
 	{
-		// Do we need to remove fee payer here????
-		AccountKeysBuffer.Append(AccountMeta.Key.DecodeBase58());
-		UpdateHeaderInfo(AccountMeta);
+		OutTransaction.Reset();
+		return false;
 	}
 
-	TArray<uint8> Buffer;
-	Buffer.Add(RequiredSignatures);
-	Buffer.Add(ReadOnlySignedAccounts);
-	Buffer.Add(ReadOnlyUnsignedAccounts);
+	SignAll(Transaction, Signers);
+	OutTransaction = MoveTemp(Transaction.Bytes);
+	return true;
+}
 
-	Buffer.Append(FCryptoUtils::ShortVectorEncodeLength(AccountList.Num()));
-	Buffer.Append(AccountKeysBuffer);
+TArray<uint8> FTransaction::Build(const TArray<FAccount>& Signers, const TArray<FAddressLookupTableAccount>& LookupTables)
+{
+	FPartiallySignedTransaction Transaction;
+	if (!BuildUnsigned(GetSignerKeys(Signers), LookupTables, Transaction)) { return TArray<uint8>(); }
 
-	Buffer.Append(FBase58::DecodeBase58(BlockHash));
+	SignAll(Transaction, Signers);
+	return MoveTemp(Transaction.Bytes);
+}
 
-	const TArray<uint8> CompiledInstructions = CompileInstructions();
-	Buffer.Append(FCryptoUtils::ShortVectorEncodeLength(Instructions.Num()));
-	Buffer.Append(CompiledInstructions);
+bool FTransaction::BuildUnsigned(const TArray<FPublicKey>& Signers, FPartiallySignedTransaction& OutTransaction) const
+{
+	FMessage Message;
+	if (!CompileMessage(Signers, Message)) { return false; }
 
-	return Buffer;
+	SerializeUnsigned(Message, Message.AccountKeys, OutTransaction);
+	return true;
 }
 
-TArray<uint8> FTransaction::CompileInstructions()
+bool FTransaction::BuildUnsigned(const TArray<FPublicKey>& Signers, const TArray<FAddressLookupTableAccount>& LookupTables,
+	FPartiallySignedTransaction& OutTransaction) const
 {
-	TArray<uint8> Result;
+	FMessageV0 Message;
+	if (!FMessageV0::Compile(Signers, Instructions, BlockHash, LookupTables, Message)) { return false; }
 
-	for (FInstruction& Instruction : Instructions)
-	{
-		const int     KeyCount = Instruction.Accounts.Num() - 1;
-		TArray<uint8> KeyIndicies;
-		KeyIndicies.SetNum(KeyCount);
-
-		for (int i = 0; i < KeyCount; i++) { KeyIndicies[i] = GetAccountIndex(Instruction.Accounts[i].Key); }
-
-		Result.Add(GetAccountIndex(
-			FBase58::EncodeBase58(Instruction.ProgramId.DecodeBase58().GetData(), Instruction.ProgramId.DecodeBase58().Num())));
-		Result.Append(FCryptoUtils::ShortVectorEncodeLength(KeyCount));
-		Result.Append(KeyIndicies);
-		Result.Append(FCryptoUtils::ShortVectorEncodeLength(Instruction.Data.Num()));
-		Result.Append(Instruction.Data);
-	}
+	SerializeUnsigned(Message, Message.StaticAccountKeys, OutTransaction);
+	return true;
+}
+
+bool FTransaction::CompileTemplate(const TArray<FPublicKey>& Signers, FTransactionTemplate& OutTemplate) const
+{
+	FMessage Message;
+	if (!CompileMessage(Signers, Message)) { return false; }
 
-	return Result;
+	SerializeUnsigned(Message, Message.AccountKeys, OutTemplate.Transaction);
+	OutTemplate.RecordOffsets(0, Message.AccountKeys.Num(), Message.Instructions);
+	return true;
 }
 
-void FTransaction::UpdateHeaderInfo(const FAccountMeta& AccountMeta)
+bool FTransaction::CompileTemplate(const TArray<FPublicKey>& Signers, const TArray<FAddressLookupTableAccount>& LookupTables,
+	FTransactionTemplate& OutTemplate) const
 {
-	if (AccountMeta.IsSigner)
-	{
-		RequiredSignatures += 1;
-		if (!AccountMeta.IsWritable) { ReadOnlySignedAccounts += 1; }
-	}
-	else { if (!AccountMeta.IsWritable) { ReadOnlyUnsignedAccounts += 1; } }
+	FMessageV0 Message;
+	if (!FMessageV0::Compile(Signers, Instructions, BlockHash, LookupTables, Message)) { return false; }
+
+	SerializeUnsigned(Message, Message.StaticAccountKeys, OutTemplate.Transaction);
+	OutTemplate.RecordOffsets(1, Message.StaticAccountKeys.Num(), Message.Instructions);
+	return true;
 }
 
 TArray<uint8> FTransaction::Sign(const TArray<uint8>& Message, const TArray<FAccount>& Signers)
 {
 	TArray<uint8> Signatures;
+	Signatures.SetNumUninitialized(FByteWriter::CompactU16Size(Signers.Num()) + Signers.Num() * SignatureSize);
 
-	Signatures.Append(FCryptoUtils::ShortVectorEncodeLength(Signers.Num()));
+	FByteWriter Writer(Signatures.GetData(), Signatures.Num());
+	Writer.WriteCompactU16(Signers.Num());
 
-	for (FAccount Signer : Signers) { Signatures.Append(Signer.Sign(Message)); }
+	TArray<int32> Slots;
+	Slots.SetNumUninitialized(Signers.Num());
+	for (int32 i = 0; i < Signers.Num(); i++) { Slots[i] = i; }
 
+	SignIntoSlots(Signers, Slots, Message.GetData(), Message.Num(), Writer.Reserve(Signers.Num() * SignatureSize));
 	return Signatures;
-}
\ No newline at end of file
+}
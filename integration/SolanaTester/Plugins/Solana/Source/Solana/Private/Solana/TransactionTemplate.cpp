@@ -0,0 +1,80 @@
+#include "Solana/TransactionTemplate.h"
+
+#include "SolanaUtils/Utils/ByteCursor.h"
+
+void FTransactionTemplate::RecordOffsets(int32 VersionPrefixSize, int32 KeyCount, const TArray<FCompiledInstruction>& Instructions)
+{
+	// Header, account keys, blockhash, then every instruction as program index, account indices and data.
+	int32 Offset = Transaction.MessageOffset + VersionPrefixSize + 3 + FByteWriter::CompactU16Size(KeyCount) + KeyCount * FPublicKey::Size;
+	BlockhashOffset = Offset;
+	Offset += FPublicKey::Size + FByteWriter::CompactU16Size(Instructions.Num());
+
+	InstructionDataOffsets.Reset(Instructions.Num());
+	InstructionDataSizes.Reset(Instructions.Num());
+	for (const FCompiledInstruction& Instruction : Instructions)
+	{
+		Offset += 1 + FByteWriter::CompactU16Size(Instruction.AccountIndices.Num()) + Instruction.AccountIndices.Num();
+		Offset += FByteWriter::CompactU16Size(Instruction.Data.Num());
+		InstructionDataOffsets.Add(Offset);
+		InstructionDataSizes.Add(Instruction.Data.Num());
+		Offset += Instruction.Data.Num();
+	}
+}
+
+uint8* FTransactionTemplate::GetMutableBytes(int32 Offset)
+{
+	Transaction.ClearSignatures();
+	return Transaction.Bytes.GetData() + Offset;
+}
+
+void FTransactionTemplate::SetBlockhash(const FPublicKey& Blockhash)
+{
+	FMemory::Memcpy(GetMutableBytes(BlockhashOffset), Blockhash.GetData(), FPublicKey::Size);
+}
+
+bool FTransactionTemplate::SetBlockhash(const FString& Blockhash)
+{
+	FPublicKey Hash;
+	if (!FPublicKey::FromBase58(Blockhash, Hash))
+	{
+		UE_LOG(LogTemp, Error, TEXT("Invalid block hash: %s"), *Blockhash);
+		return false;
+	}
+
+	SetBlockhash(Hash);
+	return true;
+}
+
+bool FTransactionTemplate::SetInstructionData(int32 Instruction, const uint8* Data, int32 Size)
+{
+	if (InstructionDataSizes.IsValidIndex(Instruction) && Size != InstructionDataSizes[Instruction])
+	{
+		UE_LOG(LogTemp, Error, TEXT("Instruction %d takes %d bytes of data, got %d"), Instruction, InstructionDataSizes[Instruction], Size);
+		return false;
+	}
+
+	return PatchInstructionData(Instruction, 0, Data, Size);
+}
+
+bool FTransactionTemplate::SetInstructionData(int32 Instruction, const TArray<uint8>& Data)
+{
+	return SetInstructionData(Instruction, Data.GetData(), Data.Num());
+}
+
+bool FTransactionTemplate::PatchInstructionData(int32 Instruction, int32 Offset, const uint8* Data, int32 Size)
+{
+	if (!InstructionDataOffsets.IsValidIndex(Instruction) || Offset < 0 || Size < 0 || Offset + Size > InstructionDataSizes[Instruction])
+	{
+		UE_LOG(LogTemp, Error, TEXT("Patch of %d bytes at %d is outside the data of instruction %d"), Size, Offset, Instruction);
+		return false;
+	}
+
+	FMemory::Memcpy(GetMutableBytes(InstructionDataOffsets[Instruction] + Offset), Data, Size);
+	return true;
+}
+
+const TArray<uint8>& FTransactionTemplate::Sign(const TArray<FAccount>& Signers)
+{
+	Transaction.Sign(Signers);
+	return Transaction.GetBytes();
+}
@@ -0,0 +1,181 @@
+#include "Solana/TransactionView.h"
+
+#include "Crypto/SignatureBatch.h"
+#include "SolanaUtils/Utils/ByteCursor.h"
+
+// The first message byte has its top bit set in versioned messages, the low bits hold the version.
+constexpr uint8 VersionPrefixFlag = 0x80;
+// Instruction account indices are one byte.
+constexpr int32 MaxAccounts = 256;
+
+namespace
+{
+	bool Reject(const TCHAR* Reason)
+	{
+		UE_LOG(LogTemp, Verbose, TEXT("Rejected transaction: %s"), Reason);
+		return false;
+	}
+
+	bool ReadCompactArray(FByteReader& Reader, TConstArrayView<uint8>& OutView)
+	{
+		int32 Num;
+		return Reader.ReadCompactU16(Num) && Reader.ReadView(Num, OutView);
+	}
+
+	bool HasDuplicateKeys(const uint8* Keys, int32 Num)
+	{
+		const auto Compare = [Keys](int32 A, int32 B) { return FMemory::Memcmp(Keys + A * FPublicKey::Size, Keys + B * FPublicKey::Size, FPublicKey::Size); };
+
+		// Sorted by index so the keys are not copied.
+		TArray<int32, TInlineAllocator<64>> Order;
+		Order.SetNumUninitialized(Num);
+		for (int32 i = 0; i < Num; i++) { Order[i] = i; }
+		Order.Sort([&Compare](int32 A, int32 B) { return Compare(A, B) < 0; });
+
+		for (int32 i = 1; i < Num; i++)
+		{
+			if (Compare(Order[i - 1], Order[i]) == 0) { return true; }
+		}
+		return false;
+	}
+
+	bool HasDuplicateIndexes(const FAddressTableLookupView& Lookup)
+	{
+		uint64 Seen[MaxAccounts / 64] = {};
+		for (const TConstArrayView<uint8>& Indexes : { Lookup.WritableIndexes, Lookup.ReadonlyIndexes })
+		{
+			for (const uint8 Index : Indexes)
+			{
+				const uint64 Bit = 1ull << (Index & 63);
+				if (Seen[Index >> 6] & Bit) { return true; }
+				Seen[Index >> 6] |= Bit;
+			}
+		}
+		return false;
+	}
+} // namespace
+
+bool FTransactionView::Parse(TConstArrayView<uint8> Bytes, FTransactionView& OutView)
+{
+	FByteReader Reader(Bytes);
+	OutView.Data = Bytes.GetData();
+	OutView.Size = Bytes.Num();
+	OutView.Instructions.Reset();
+	OutView.AddressTableLookups.Reset();
+	OutView.LoadedWritableCount = 0;
+	OutView.LoadedReadonlyCount = 0;
+
+	int32 SignatureCount;
+	if (!Reader.ReadCompactU16(SignatureCount)) { return Reject(TEXT("truncated signature count")); }
+	OutView.SignaturesOffset = Reader.Tell();
+	if (!Reader.Skip(SignatureCount * SignatureSize)) { return Reject(TEXT("truncated signatures")); }
+
+	OutView.MessageOffset = Reader.Tell();
+	uint8 Prefix;
+	if (!Reader.ReadU8(Prefix)) { return Reject(TEXT("missing message")); }
+
+	FMessageHeader& Header = OutView.Header;
+	OutView.bVersioned = (Prefix & VersionPrefixFlag) != 0;
+	if (OutView.bVersioned)
+	{
+		OutView.Version = Prefix & ~VersionPrefixFlag;
+		if (OutView.Version != 0) { return Reject(TEXT("unsupported message version")); }
+		if (!Reader.ReadU8(Header.NumRequiredSignatures)) { return Reject(TEXT("truncated header")); }
+	}
+	else
+	{
+		// Legacy messages start with the header directly.
+		OutView.Version = 0;
+		Header.NumRequiredSignatures = Prefix;
+	}
+
+	if (!Reader.ReadU8(Header.NumReadonlySignedAccounts) || !Reader.ReadU8(Header.NumReadonlyUnsignedAccounts))
+	{
+		return Reject(TEXT("truncated header"));
+	}
+	if (SignatureCount != Header.NumRequiredSignatures) { return Reject(TEXT("signature count does not match the header")); }
+	if (Header.NumReadonlySignedAccounts >= Header.NumRequiredSignatures) { return Reject(TEXT("fee payer is not a writable signer")); }
+
+	if (!Reader.ReadCompactU16(OutView.StaticKeyCount)) { return Reject(TEXT("truncated account keys")); }
+	if (Header.NumRequiredSignatures + Header.NumReadonlyUnsignedAccounts > OutView.StaticKeyCount)
+	{
+		return Reject(TEXT("header counts exceed the account keys"));
+	}
+	OutView.KeysOffset = Reader.Tell();
+	if (!Reader.Skip(OutView.StaticKeyCount * FPublicKey::Size)) { return Reject(TEXT("truncated account keys")); }
+
+	OutView.BlockhashOffset = Reader.Tell();
+	if (!Reader.Skip(FPublicKey::Size)) { return Reject(TEXT("truncated blockhash")); }
+
+	int32 InstructionCount;
+	if (!Reader.ReadCompactU16(InstructionCount)) { return Reject(TEXT("truncated instructions")); }
+	OutView.Instructions.Reserve(InstructionCount);
+	for (int32 i = 0; i < InstructionCount; i++)
+	{
+		FInstructionView& Instruction = OutView.Instructions.AddDefaulted_GetRef();
+		if (!Reader.ReadU8(Instruction.ProgramIdIndex) || !ReadCompactArray(Reader, Instruction.AccountIndices)
+			|| !ReadCompactArray(Reader, Instruction.Data))
+		{
+			return Reject(TEXT("truncated instruction"));
+		}
+	}
+
+	if (OutView.bVersioned)
+	{
+		int32 LookupCount;
+		if (!Reader.ReadCompactU16(LookupCount)) { return Reject(TEXT("truncated address table lookups")); }
+		OutView.AddressTableLookups.Reserve(LookupCount);
+		for (int32 i = 0; i < LookupCount; i++)
+		{
+			FAddressTableLookupView& Lookup = OutView.AddressTableLookups.AddDefaulted_GetRef();
+			Lookup.AccountKey = Reader.GetData() + Reader.Tell();
+			if (!Reader.Skip(FPublicKey::Size) || !ReadCompactArray(Reader, Lookup.WritableIndexes)
+				|| !ReadCompactArray(Reader, Lookup.ReadonlyIndexes))
+			{
+				return Reject(TEXT("truncated address table lookup"));
+			}
+			if (Lookup.WritableIndexes.IsEmpty() && Lookup.ReadonlyIndexes.IsEmpty()) { return Reject(TEXT("address table lookup loads nothing")); }
+			if (HasDuplicateIndexes(Lookup)) { return Reject(TEXT("address table lookup loads an address twice")); }
+
+			OutView.LoadedWritableCount += Lookup.WritableIndexes.Num();
+			OutView.LoadedReadonlyCount += Lookup.ReadonlyIndexes.Num();
+		}
+	}
+	if (!Reader.IsAtEnd()) { return Reject(TEXT("trailing bytes")); }
+
+	const int32 AccountCount = OutView.GetAccountCount();
+	if (AccountCount > MaxAccounts) { return Reject(TEXT("too many accounts")); }
+	if (HasDuplicateKeys(OutView.Data + OutView.KeysOffset, OutView.StaticKeyCount)) { return Reject(TEXT("duplicate account keys")); }
+
+	for (const FInstructionView& Instruction : OutView.Instructions)
+	{
+		// Programs must be static keys, and the fee payer cannot be one.
+		if (Instruction.ProgramIdIndex == 0 || Instruction.ProgramIdIndex >= OutView.StaticKeyCount)
+		{
+			return Reject(TEXT("invalid program id index"));
+		}
+		for (const uint8 Index : Instruction.AccountIndices)
+		{
+			if (Index >= AccountCount) { return Reject(TEXT("account index out of range")); }
+		}
+	}
+
+	return true;
+}
+
+bool FTransactionView::IsWritable(int32 Index) const
+{
+	if (Index < Header.NumRequiredSignatures) { return Index < Header.NumRequiredSignatures - Header.NumReadonlySignedAccounts; }
+	if (Index < StaticKeyCount) { return Index < StaticKeyCount - Header.NumReadonlyUnsignedAccounts; }
+	return Index < StaticKeyCount + LoadedWritableCount;
+}
+
+bool FTransactionView::VerifySignatures() const
+{
+	const TConstArrayView<uint8> Message = GetMessage();
+
+	FSignatureBatch Batch;
+	Batch.Reserve(GetSignatureCount());
+	for (int32 i = 0; i < GetSignatureCount(); i++) { Batch.Add(Message.GetData(), Message.Num(), GetSignature(i), GetStaticAccountKeyData(i)); }
+	return Batch.VerifyStrict();
+}
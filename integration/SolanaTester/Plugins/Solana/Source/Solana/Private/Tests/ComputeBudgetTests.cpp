@@ -0,0 +1,147 @@
+#include "Misc/AutomationTest.h"
+#include "Misc/Base64.h"
+#include "Solana/ComputeBudgetProgram.h"
+#include "Solana/Instruction.h"
+#include "Solana/SystemProgram.h"
+#include "Solana/TransactionView.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+/**
+ * The simulation is replaced by a canned consumption, answered when the test chooses to, so the margin, the cap, the
+ * order of the compute budget instructions and the sharing of one simulation per shape are checked without a network.
+ */
+namespace ComputeBudgetTests
+{
+	const TCHAR* Payer = TEXT("AKkzLhjhyFtM9j7WAhbaqYpFe49cXeJBg2kzLRC2PnNa");
+	const TCHAR* Recipient = TEXT("GyGKxMyg1p9SsHfm15MkNUu1u9TN2JtTspcdmrtGUdse");
+	const TCHAR* Program = TEXT("EdmxWPmx2WH6WgFfTdu9xfkYf3k1g5wD1zccTVySEEh1");
+
+	FInstruction MakeTransfer(uint64 Lamports)
+	{
+		FInstruction Instruction;
+		Instruction.ProgramId = FSystemProgram::ProgramId;
+		Instruction.Accounts.Add(FAccountMeta(FPublicKey(FString(Payer)), true, true));
+		Instruction.Accounts.Add(FAccountMeta(FPublicKey(FString(Recipient)), false, true));
+		Instruction.Data = { 2, 0, 0, 0 };
+		for (int32 i = 0; i < 8; i++) { Instruction.Data.Add(static_cast<uint8>(Lamports >> (i * 8))); }
+		return Instruction;
+	}
+
+	FInstruction MakeProgramCall(uint8 Discriminator)
+	{
+		FInstruction Instruction;
+		Instruction.ProgramId = FPublicKey(FString(Program));
+		Instruction.Accounts.Add(FAccountMeta(FPublicKey(FString(Payer)), true, true));
+		Instruction.Data = { Discriminator };
+		return Instruction;
+	}
+
+	bool TestInstruction(FAutomationTestBase& Test, const TCHAR* What, const FInstruction& Actual, const FInstruction& Expected)
+	{
+		return Test.TestTrue(What, Actual.ProgramId == Expected.ProgramId && Actual.Data == Expected.Data);
+	}
+} // namespace ComputeBudgetTests
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSolanaComputeBudgetOptimizerTest, "Solana.ComputeBudget.Optimizer",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::EngineFilter)
+
+bool FSolanaComputeBudgetOptimizerTest::RunTest(const FString& Parameters)
+{
+	using namespace ComputeBudgetTests;
+
+	FComputeBudgetOptimizer& Optimizer = FComputeBudgetOptimizer::Get();
+	Optimizer.Reset();
+	Optimizer.SetSafetyMargin(0.1f);
+	Optimizer.SetComputeUnitPrice(1000);
+
+	int32                          Simulations = 0;
+	TArray<uint8>                  Simulated;
+	TFunction<void(const uint64*)> Answer;
+	Optimizer.SetSimulator([&](const FString& Transaction, TFunction<void(const uint64*)> OnSimulated)
+	{
+		Simulations++;
+		Simulated.Reset();
+		FBase64::Decode(Transaction, Simulated);
+		Answer = MoveTemp(OnSimulated);
+	});
+
+	// A limit already in the list is replaced, not kept next to the optimized one, and is not part of the shape.
+	const TArray<FInstruction> Transfer = { FComputeBudgetProgram::SetComputeUnitLimit(5), MakeTransfer(1000) };
+	const TArray<FPublicKey>   Signers = { FPublicKey(FString(Payer)) };
+
+	TArray<TArray<FInstruction>> Results;
+	const auto Collect = [&Results](const TArray<FInstruction>* Instructions)
+	{
+		if (Instructions) { Results.Add(*Instructions); }
+	};
+
+	Optimizer.Optimize(Transfer, Signers, Collect);
+	Optimizer.Optimize({ MakeTransfer(1000) }, Signers, Collect);
+	TestEqual(TEXT("Both transfers share one simulation"), Simulations, 1);
+	TestEqual(TEXT("Nothing is ready before the simulation"), Results.Num(), 0);
+
+	FTransactionView View;
+	if (TestTrue(TEXT("Simulated transaction parses"), FTransactionView::Parse(Simulated, View)))
+	{
+		const FInstructionView& First = View.GetInstructions()[0];
+		const FInstruction      Limit = FComputeBudgetProgram::SetComputeUnitLimit(FComputeBudgetProgram::MaxComputeUnitLimit);
+		TestEqual(TEXT("Simulated instructions"), View.GetInstructions().Num(), 3);
+		TestTrue(TEXT("Simulated with the largest limit"), View.GetStaticAccountKey(First.ProgramIdIndex) == FComputeBudgetProgram::ProgramId
+			&& TArray<uint8>(First.Data.GetData(), First.Data.Num()) == Limit.Data);
+	}
+
+	// 12345 units plus 10% is 13579.5, rounded up.
+	const uint64 Consumed = 12345;
+	Answer(&Consumed);
+	if (TestEqual(TEXT("Both transfers are ready"), Results.Num(), 2))
+	{
+		for (const TArray<FInstruction>& Result : Results)
+		{
+			if (!TestEqual(TEXT("Limit, price and transfer"), Result.Num(), 3)) { continue; }
+
+			TestInstruction(*this, TEXT("Limit comes first"), Result[0], FComputeBudgetProgram::SetComputeUnitLimit(13580));
+			TestInstruction(*this, TEXT("Price comes second"), Result[1], FComputeBudgetProgram::SetComputeUnitPrice(1000));
+			TestTrue(TEXT("Transfer comes last"), Result[2].ProgramId == FSystemProgram::ProgramId);
+		}
+	}
+
+	uint32 Units = 0;
+	TestTrue(TEXT("Shape is known"), Optimizer.FindComputeUnitLimit({ MakeTransfer(1000) }, Units));
+	TestEqual(TEXT("Stored limit"), Units, 13580u);
+
+	// Known shapes are optimized right away, without a price while it is 0.
+	Optimizer.SetComputeUnitPrice(0);
+	TArray<FInstruction> Optimized;
+	if (TestTrue(TEXT("TryOptimize"), Optimizer.TryOptimize(Transfer, Optimized)) && TestEqual(TEXT("Limit and transfer"), Optimized.Num(), 2))
+	{
+		TestInstruction(*this, TEXT("Limit without a price"), Optimized[0], FComputeBudgetProgram::SetComputeUnitLimit(13580));
+	}
+	TestEqual(TEXT("Known shapes are not simulated again"), Simulations, 1);
+
+	// The limit never goes past what the runtime accepts.
+	Results.Reset();
+	Optimizer.Optimize({ MakeProgramCall(1) }, Signers, Collect);
+	const uint64 Heavy = 1300000;
+	Answer(&Heavy);
+	if (TestEqual(TEXT("Heavy call is ready"), Results.Num(), 1))
+	{
+		TestInstruction(*this, TEXT("Limit is capped"), Results[0][0],
+			FComputeBudgetProgram::SetComputeUnitLimit(FComputeBudgetProgram::MaxComputeUnitLimit));
+	}
+
+	// A failed simulation reports nullptr and leaves the shape unknown.
+	bool bFailed = false;
+	Optimizer.Optimize({ MakeProgramCall(2) }, Signers, [&bFailed](const TArray<FInstruction>* Instructions) { bFailed = Instructions == nullptr; });
+	Answer(nullptr);
+	TestTrue(TEXT("Failure reaches the caller"), bFailed);
+	TestFalse(TEXT("Failed shape is not stored"), Optimizer.FindComputeUnitLimit({ MakeProgramCall(2) }, Units));
+	TestEqual(TEXT("Simulations"), Simulations, 3);
+
+	Optimizer.SetSimulator(nullptr);
+	Optimizer.SetSafetyMargin(0.1f);
+	Optimizer.Reset();
+	return true;
+}
+
+#endif
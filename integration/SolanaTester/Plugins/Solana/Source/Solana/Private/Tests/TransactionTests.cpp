@@ -0,0 +1,253 @@
+#include "Misc/AutomationTest.h"
+#include "Misc/Base64.h"
+#include "Solana/AddressLookupTable.h"
+#include "Solana/ComputeBudgetProgram.h"
+#include "Solana/Instruction.h"
+#include "Solana/SystemProgram.h"
+#include "Solana/Transaction.h"
+#include "Solana/TransactionTemplate.h"
+#include "Solana/TransactionView.h"
+#include "SolanaUtils/Account.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+/**
+ * Wire format fixtures. Every field was laid out by hand from the transaction format documentation, independently of
+ * FMessage, and signed with OpenSSL's Ed25519. The signers come from 32 byte seeds filled with 0x01 and 0x02, so any
+ * change to key ordering, compact-u16 encoding, the v0 prefix or lookup indexing shows up as a byte difference.
+ */
+namespace TransactionTests
+{
+	const TCHAR* Blockhash = TEXT("EkSnNWid2cvwEVnVx9aBqawnmiCNiDgp3gUdkDPTKN1N");
+	const TCHAR* Recipient = TEXT("GyGKxMyg1p9SsHfm15MkNUu1u9TN2JtTspcdmrtGUdse");
+	const TCHAR* LookupTable = TEXT("8SFqwqnq4whPhs8icwHA2hQg3hUoN1qrCLK1SBx3WKwe");
+	const TCHAR* Program = TEXT("AKkzLhjhyFtM9j7WAhbaqYpFe49cXeJBg2kzLRC2PnNa");
+	const TCHAR* Unused = TEXT("EdmxWPmx2WH6WgFfTdu9xfkYf3k1g5wD1zccTVySEEh1");
+	const TCHAR* Clock = TEXT("SysvarC1ock11111111111111111111111111111111");
+
+	// Fee payer 0x01.., transfer of 1000000 lamports from the co-signer 0x02.. to Recipient.
+	const TCHAR* LegacyTransfer = TEXT(
+		"AtQdBmt2DST25dB5/M2rDVDaBVH9T8tZmr0I07ynbrEFTyR9zTeDVfbtV3f7DbVR+S5iTq/tXs3SE1DN+hmDeA0HDmvrtMfnZPo+0mpik0u98I8ieYxh"
+		"a9KtHWR9jtAHrUB5s8d0Zw4k9Nm6ToPEEDghthpkHgGKaVoVObih/MEGAgABBIqI4910CfGV/VLbLTy6XXLKZwm/HZQSG/N0iAG0D29cgTl3Dqh9F19W"
+		"o1Rmw0x+zMuNipG07jeiXfYPW4/Js5TtSSjGKNHCxurpAziQWZVhKVknOlxj+TY2wUYUrIc30QAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAA"
+		"zEkOkozS44c7s0P8ldozF5ymD02/RsLDbpEpnVXU5rkBAwIBAgwCAAAAQEIPAAAAAAA=");
+
+	// Fee payer 0x01.., a compute unit limit, a transfer of 5000 lamports to Recipient looked up as writable, and an
+	// instruction of Program reading the clock sysvar looked up as read-only.
+	const TCHAR* VersionedTransfer = TEXT(
+		"AaLo6zT5MPY66l5NEX1aRyVlMLM7s1EJKhhQ7DM7fkYEdSLK7Yt/nXHSsB3v2wlWvI6Lz8sqgsZzZSSKR1s8WwWAAQADBIqI4910CfGV/VLbLTy6XXLK"
+		"Zwm/HZQSG/N0iAG0D29cAwZGb+UhFzL/7K26csOb57yM5bvF9xJrLEObOkAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAIqHX/8es4RR"
+		"V3rNWv7kBUVlaN18ieCQhjoFV7x69J8XzEkOkozS44c7s0P8ldozF5ymD02/RsLDbpEpnVXU5rkDAQAFAkANAwACAgAEDAIAAACIEwAAAAAAAAMBBQEB"
+		"AW56HN0psLeP0Tr0xVmP7/TvKpcWbjym8uT7/M2AUFvxAQEBAA==");
+
+	FAccount MakeSigner(uint8 Seed)
+	{
+		TArray<uint8> SeedBytes;
+		SeedBytes.Init(Seed, 32);
+		return FAccount::FromSeed(SeedBytes);
+	}
+
+	FInstruction MakeTransfer(const FPublicKey& From, const FPublicKey& To, uint64 Lamports)
+	{
+		FInstruction Instruction;
+		Instruction.ProgramId = FSystemProgram::ProgramId;
+		Instruction.Accounts.Add(FAccountMeta(From, true, true));
+		Instruction.Accounts.Add(FAccountMeta(To, false, true));
+		Instruction.Data = { 2, 0, 0, 0 };
+		for (int32 i = 0; i < 8; i++) { Instruction.Data.Add(static_cast<uint8>(Lamports >> (i * 8))); }
+		return Instruction;
+	}
+
+	// Little endian bytes of Value, as instruction arguments are encoded.
+	TArray<uint8> ToLittleEndian(uint64 Value, int32 Size)
+	{
+		TArray<uint8> Bytes;
+		for (int32 i = 0; i < Size; i++) { Bytes.Add(static_cast<uint8>(Value >> (i * 8))); }
+		return Bytes;
+	}
+
+	bool TestBytes(FAutomationTestBase& Test, const TArray<uint8>& Actual, const TCHAR* ExpectedBase64)
+	{
+		TArray<uint8> Expected;
+		if (!Test.TestTrue(TEXT("Fixture decodes"), FBase64::Decode(ExpectedBase64, Expected))) { return false; }
+		if (!Test.TestEqual(TEXT("Transaction size"), Actual.Num(), Expected.Num())) { return false; }
+
+		for (int32 i = 0; i < Expected.Num(); i++)
+		{
+			if (Actual[i] != Expected[i])
+			{
+				Test.AddError(FString::Printf(TEXT("First difference at byte %d: %d, expected %d"), i, Actual[i], Expected[i]));
+				return false;
+			}
+		}
+		return true;
+	}
+} // namespace TransactionTests
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSolanaLegacyTransactionTest, "Solana.Transaction.Legacy",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::EngineFilter)
+
+bool FSolanaLegacyTransactionTest::RunTest(const FString& Parameters)
+{
+	using namespace TransactionTests;
+
+	const FAccount Payer = MakeSigner(1);
+	const FAccount CoSigner = MakeSigner(2);
+
+	FTransaction Transaction(Blockhash);
+	Transaction.AddInstruction(MakeTransfer(CoSigner.Key, FPublicKey(FString(Recipient)), 1000000));
+
+	TestBytes(*this, Transaction.Build({ Payer, CoSigner }), LegacyTransfer);
+
+	// Signing in place must produce the same bytes as signing while building.
+	FPartiallySignedTransaction Unsigned;
+	if (TestTrue(TEXT("BuildUnsigned"), Transaction.BuildUnsigned({ Payer.Key, CoSigner.Key }, Unsigned)))
+	{
+		TestFalse(TEXT("Unsigned transaction is not fully signed"), Unsigned.IsFullySigned());
+		Unsigned.Sign({ CoSigner, Payer });
+		TestTrue(TEXT("Signed in place"), Unsigned.IsFullySigned() && Unsigned.VerifySignatures());
+		TestBytes(*this, Unsigned.GetBytes(), LegacyTransfer);
+	}
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSolanaVersionedTransactionTest, "Solana.Transaction.V0LookupTable",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::EngineFilter)
+
+bool FSolanaVersionedTransactionTest::RunTest(const FString& Parameters)
+{
+	using namespace TransactionTests;
+
+	const FAccount Payer = MakeSigner(1);
+	const FPublicKey RecipientKey = FPublicKey(FString(Recipient));
+
+	FInstruction ReadClock;
+	ReadClock.ProgramId = FPublicKey(FString(Program));
+	ReadClock.Accounts.Add(FAccountMeta(FPublicKey(FString(Clock)), false, false));
+	ReadClock.Data = { 1 };
+
+	FTransaction Transaction(Blockhash);
+	Transaction.AddInstruction(FComputeBudgetProgram::SetComputeUnitLimit(200000));
+	Transaction.AddInstruction(MakeTransfer(Payer.Key, RecipientKey, 5000));
+	Transaction.AddInstruction(ReadClock);
+
+	const FAddressLookupTableAccount Table(FPublicKey(FString(LookupTable)),
+		{ FPublicKey(FString(Clock)), RecipientKey, FPublicKey(FString(Unused)) });
+
+	TestBytes(*this, Transaction.Build({ Payer }, { Table }), VersionedTransfer);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSolanaTransactionViewTest, "Solana.Transaction.View",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::EngineFilter)
+
+bool FSolanaTransactionViewTest::RunTest(const FString& Parameters)
+{
+	using namespace TransactionTests;
+
+	TArray<uint8> Bytes;
+	FBase64::Decode(LegacyTransfer, Bytes);
+
+	FTransactionView View;
+	if (!TestTrue(TEXT("Legacy fixture parses"), FTransactionView::Parse(Bytes, View))) { return true; }
+	TestEqual(TEXT("Signatures"), View.GetSignatureCount(), 2);
+	TestTrue(TEXT("Signatures verify"), View.VerifySignatures());
+
+	// The co-signer's key written over the recipient's.
+	const int32   KeysOffset = View.GetStaticAccountKeyData(0) - Bytes.GetData();
+	TArray<uint8> Duplicated = Bytes;
+	FMemory::Memcpy(Duplicated.GetData() + KeysOffset + 2 * FPublicKey::Size, Bytes.GetData() + KeysOffset + FPublicKey::Size, FPublicKey::Size);
+	TestFalse(TEXT("Duplicate account keys are rejected"), FTransactionView::Parse(Duplicated, View));
+
+	// The identity point as key, R as the identity and s = 0 satisfy the cofactorless equation for any message, the
+	// runtime still rejects them.
+	uint8 IdentityPoint[FPublicKey::Size] = { 1 };
+	uint8 Signature[FTransactionView::SignatureSize] = { 1 };
+	const FPublicKey Identity(IdentityPoint, FPublicKey::Size);
+
+	FTransaction Transaction(Blockhash);
+	Transaction.AddInstruction(MakeTransfer(Identity, FPublicKey(FString(Recipient)), 1));
+
+	FPartiallySignedTransaction Forged;
+	if (TestTrue(TEXT("BuildUnsigned"), Transaction.BuildUnsigned({ Identity }, Forged)))
+	{
+		Forged.SetSignature(0, Signature);
+		TestFalse(TEXT("Small order signature is rejected"), Forged.VerifySignatures());
+		TestTrue(TEXT("Forged transaction parses"), FTransactionView::Parse(Forged.GetBytes(), View));
+		TestFalse(TEXT("Small order signature is rejected by the view"), View.VerifySignatures());
+	}
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSolanaTransactionTemplateTest, "Solana.Transaction.Template",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::EngineFilter)
+
+bool FSolanaTransactionTemplateTest::RunTest(const FString& Parameters)
+{
+	using namespace TransactionTests;
+
+	const FAccount   Payer = MakeSigner(1);
+	const FAccount   CoSigner = MakeSigner(2);
+	const FPublicKey RecipientKey = FPublicKey(FString(Recipient));
+	// Any 32 bytes make a blockhash, the patched one only has to differ from the compiled one.
+	const FString    NewBlockhash = Unused;
+
+	// Legacy: the transfer of the legacy fixture, then its blockhash and amount patched.
+	FTransaction Legacy(Blockhash);
+	Legacy.AddInstruction(MakeTransfer(CoSigner.Key, RecipientKey, 1000000));
+
+	FTransactionTemplate LegacyTemplate;
+	if (TestTrue(TEXT("Legacy template compiles"), Legacy.CompileTemplate({ Payer.Key, CoSigner.Key }, LegacyTemplate)))
+	{
+		TestBytes(*this, LegacyTemplate.Sign({ Payer, CoSigner }), LegacyTransfer);
+
+		TestTrue(TEXT("Legacy blockhash patched"), LegacyTemplate.SetBlockhash(NewBlockhash));
+		TestFalse(TEXT("Patching clears the signatures"), LegacyTemplate.GetTransaction().IsFullySigned());
+		const TArray<uint8> Lamports = ToLittleEndian(2500000, 8);
+		TestTrue(TEXT("Legacy amount patched"), LegacyTemplate.PatchInstructionData(0, 4, Lamports.GetData(), Lamports.Num()));
+		TestFalse(TEXT("Patch past the instruction data is rejected"), LegacyTemplate.PatchInstructionData(0, 5, Lamports.GetData(), Lamports.Num()));
+		TestFalse(TEXT("Data of another size is rejected"), LegacyTemplate.SetInstructionData(0, Lamports));
+
+		FTransaction Rebuilt(NewBlockhash);
+		Rebuilt.AddInstruction(MakeTransfer(CoSigner.Key, RecipientKey, 2500000));
+		TestEqual(TEXT("Patched legacy template matches a fresh build"), LegacyTemplate.Sign({ Payer, CoSigner }), Rebuilt.Build({ Payer, CoSigner }));
+	}
+
+	// Version 0: the instructions of the lookup table fixture, then the blockhash, the compute unit limit replaced whole
+	// and the transfer amount patched.
+	FInstruction ReadClock;
+	ReadClock.ProgramId = FPublicKey(FString(Program));
+	ReadClock.Accounts.Add(FAccountMeta(FPublicKey(FString(Clock)), false, false));
+	ReadClock.Data = { 1 };
+
+	const FAddressLookupTableAccount Table(FPublicKey(FString(LookupTable)),
+		{ FPublicKey(FString(Clock)), RecipientKey, FPublicKey(FString(Unused)) });
+
+	const auto MakeVersioned = [&](const FString& Hash, uint32 UnitLimit, uint64 Amount)
+	{
+		FTransaction Transaction(Hash);
+		Transaction.AddInstruction(FComputeBudgetProgram::SetComputeUnitLimit(UnitLimit));
+		Transaction.AddInstruction(MakeTransfer(Payer.Key, RecipientKey, Amount));
+		Transaction.AddInstruction(ReadClock);
+		return Transaction;
+	};
+
+	FTransactionTemplate VersionedTemplate;
+	if (TestTrue(TEXT("Version 0 template compiles"), MakeVersioned(Blockhash, 200000, 5000).CompileTemplate({ Payer.Key }, { Table }, VersionedTemplate)))
+	{
+		TestEqual(TEXT("Instructions"), VersionedTemplate.GetInstructionCount(), 3);
+		TestBytes(*this, VersionedTemplate.Sign({ Payer }), VersionedTransfer);
+
+		VersionedTemplate.SetBlockhash(FPublicKey(NewBlockhash));
+		TestTrue(TEXT("Compute unit limit replaced"),
+			VersionedTemplate.SetInstructionData(0, FComputeBudgetProgram::SetComputeUnitLimit(300000).Data));
+		const TArray<uint8> Lamports = ToLittleEndian(7500, 8);
+		TestTrue(TEXT("Version 0 amount patched"), VersionedTemplate.PatchInstructionData(1, 4, Lamports.GetData(), Lamports.Num()));
+
+		TestEqual(TEXT("Patched version 0 template matches a fresh build"), VersionedTemplate.Sign({ Payer }),
+			MakeVersioned(NewBlockhash, 300000, 7500).Build({ Payer }, { Table }));
+	}
+	return true;
+}
+
+#endif
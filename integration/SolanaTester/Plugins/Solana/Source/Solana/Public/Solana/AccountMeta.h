@@ -19,6 +19,10 @@ struct FAccountMeta
 	// True if the account data or metadata may be mutated during program execution.
 	bool IsWritable;
 
-	FAccountMeta(FPublicKey InKey, bool InIsSigner, bool InIsWriteable);
-	FAccountMeta(TArray<uint8> InKeyData, bool InIsSigner, bool InIsWriteable);
+	constexpr FAccountMeta(const FPublicKey& InKey, bool InIsSigner, bool InIsWriteable)
+		: Key(InKey)
+		, IsSigner(InIsSigner)
+		, IsWritable(InIsWriteable) {}
+
+	FAccountMeta(const TArray<uint8>& InKeyData, bool InIsSigner, bool InIsWriteable);
 };
\ No newline at end of file
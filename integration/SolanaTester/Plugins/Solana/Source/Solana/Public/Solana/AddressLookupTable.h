@@ -0,0 +1,75 @@
+#pragma once
+#include "Instruction.h"
+
+/**
+ * The contents of an on-chain address lookup table.
+ */
+struct FAddressLookupTableAccount
+{
+	FAddressLookupTableAccount() = default;
+	FAddressLookupTableAccount(const FPublicKey& InKey, const TArray<FPublicKey>& InAddresses);
+
+	// Parses the raw account data of a lookup table, returns false if it is not a lookup table account.
+	static bool Deserialize(const FPublicKey& InKey, const TArray<uint8>& Data, FAddressLookupTableAccount& OutTable);
+
+	// Position of Address in the table, or INDEX_NONE.
+	int32 IndexOf(const FPublicKey& Address) const;
+
+	const FPublicKey&         GetKey() const { return Key; }
+	const TArray<FPublicKey>& GetAddresses() const { return Addresses; }
+
+	// Slot at which the table was deactivated, MAX_uint64 while it is active.
+	uint64 DeactivationSlot = MAX_uint64;
+
+private:
+	FPublicKey         Key;
+	TArray<FPublicKey> Addresses;
+	TMap<FPublicKey, uint8> AddressIndices;
+};
+
+/**
+ * Instructions of the address lookup table program.
+ */
+class FAddressLookupTableProgram
+{
+public:
+	static const FPublicKey ProgramId;
+
+	/**
+	 * Creates a lookup table owned by Authority.
+	 * @param RecentSlot A recent slot, the table address is derived from it and the authority.
+	 * @param OutTableAddress Address of the table that will be created.
+	 */
+	static FInstruction CreateLookupTable(const FPublicKey& Authority, const FPublicKey& Payer, uint64 RecentSlot, FPublicKey& OutTableAddress);
+
+	// Appends addresses to a table, Payer funds the extra rent.
+	static FInstruction ExtendLookupTable(const FPublicKey& Table, const FPublicKey& Authority, const FPublicKey& Payer,
+		const TArray<FPublicKey>& NewAddresses);
+};
+
+/**
+ * Process wide cache of fetched lookup tables, so building a v0 transaction does not need a round trip
+ * once a table has been seen.
+ */
+class FAddressLookupTableCache
+{
+public:
+	static FAddressLookupTableCache& Get();
+
+	void Add(const FAddressLookupTableAccount& Table);
+	void Remove(const FPublicKey& TableKey);
+
+	// Returns false if the table has not been fetched yet.
+	bool Find(const FPublicKey& TableKey, FAddressLookupTableAccount& OutTable) const;
+
+	/**
+	 * Calls OnLoaded with the table, fetching it with getAccountInfo if it is not cached yet.
+	 * OnLoaded receives nullptr if the account does not exist or is not a lookup table.
+	 */
+	void Fetch(const FPublicKey& TableKey, TFunction<void(const FAddressLookupTableAccount*)> OnLoaded);
+
+private:
+	mutable FCriticalSection Lock;
+
+	TMap<FPublicKey, FAddressLookupTableAccount> Tables;
+};
@@ -0,0 +1,95 @@
+#pragma once
+#include "Instruction.h"
+
+/**
+ * Instructions of the compute budget program. They apply to the whole transaction wherever they are, by convention
+ * they come first.
+ */
+class FComputeBudgetProgram
+{
+public:
+	static const FPublicKey ProgramId;
+
+	// Most compute units a transaction can request.
+	static constexpr uint32 MaxComputeUnitLimit = 1400000;
+	// Units a transaction gets per instruction when it does not set a limit.
+	static constexpr uint32 DefaultInstructionComputeUnitLimit = 200000;
+
+	// Caps the compute units the transaction may consume. Leaders schedule a transaction by the units it requests, not the ones it uses.
+	static FInstruction SetComputeUnitLimit(uint32 Units);
+
+	// Priority fee in micro-lamports per requested compute unit.
+	static FInstruction SetComputeUnitPrice(uint64 MicroLamports);
+
+	// Heap size for the programs of the transaction, a multiple of 1024 bytes up to 256 KiB.
+	static FInstruction RequestHeapFrame(uint32 Bytes);
+
+	static bool IsComputeBudgetInstruction(const FInstruction& Instruction) { return Instruction.ProgramId == ProgramId; }
+};
+
+/**
+ * FComputeBudgetOptimizer
+ *
+ * Sizes the compute unit limit of transactions from what they actually consume, instead of the default 200k units
+ * per instruction. The first time a shape of instructions is seen it is simulated with simulateTransaction, the
+ * consumed units plus SafetyMargin are stored for the shape and every later transaction of that shape gets its
+ * limit without a round trip.
+ *
+ * The shape of an instruction is its program, the signer and writable flags of its accounts, its data size and the
+ * first 8 bytes of its data, which name the instruction for Anchor programs. Instructions of one shape are expected to
+ * run the same code path, arguments that change the work a program does make the cached figure an estimate, the
+ * margin covers the difference.
+ */
+class FComputeBudgetOptimizer
+{
+public:
+	static FComputeBudgetOptimizer& Get();
+
+	// Fraction added on top of the simulated consumption, 0.1 by default.
+	void SetSafetyMargin(float Margin);
+
+	// Priority fee of every optimized transaction, in micro-lamports per compute unit. No price instruction is added while it is 0.
+	void SetComputeUnitPrice(uint64 MicroLamports);
+
+	/**
+	 * Calls OnReady with the instructions preceded by SetComputeUnitLimit and SetComputeUnitPrice. Compute budget
+	 * instructions already in the list are replaced. Runs right away when the shape is known, otherwise once its
+	 * simulation completes, concurrent requests for the same shape share one simulation.
+	 * @param Signers Keys that will sign the transaction, fee payer first. Signatures are not checked by the simulation.
+	 * OnReady receives nullptr if the simulation fails.
+	 */
+	void Optimize(const TArray<FInstruction>& Instructions, const TArray<FPublicKey>& Signers,
+		TFunction<void(const TArray<FInstruction>*)> OnReady);
+
+	// Synchronous form of Optimize, returns false without simulating when the shape has not been simulated yet.
+	bool TryOptimize(const TArray<FInstruction>& Instructions, TArray<FInstruction>& OutInstructions) const;
+
+	// Limit stored for the shape of Instructions, or false if it has not been simulated yet.
+	bool FindComputeUnitLimit(const TArray<FInstruction>& Instructions, uint32& OutUnits) const;
+
+	// Forgets every simulated shape, after a program upgrade for instance.
+	void Reset();
+
+	// Simulates a base64 transaction and reports the units it consumed, or nullptr if the simulation failed.
+	using FSimulateFunc = TFunction<void(const FString& Transaction, TFunction<void(const uint64*)> OnSimulated)>;
+
+	// Replaces the simulateTransaction request, for tests. Pass nullptr to simulate on the network again.
+	void SetSimulator(FSimulateFunc InSimulator);
+
+private:
+	static FString GetShapeKey(const TArray<FInstruction>& Instructions);
+
+	void Prepend(uint32 Units, const TArray<FInstruction>& Instructions, TArray<FInstruction>& OutInstructions) const;
+	void OnSimulated(const FString& Shape, const uint64* UnitsConsumed);
+
+	mutable FCriticalSection Lock;
+
+	float  SafetyMargin = 0.1f;
+	uint64 ComputeUnitPrice = 0;
+
+	FSimulateFunc Simulator;
+
+	TMap<FString, uint32> Limits;
+	// Callers waiting for the simulation of a shape, a shape only has one simulation in flight.
+	TMap<FString, TArray<TFunction<void(const uint32*)>>> Waiters;
+};
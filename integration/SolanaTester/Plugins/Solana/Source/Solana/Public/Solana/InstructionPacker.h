@@ -0,0 +1,64 @@
+#pragma once
+#include "Instruction.h"
+
+/**
+ * One transaction produced by FInstructionPacker.
+ */
+struct FPackedTransaction
+{
+	// Keys that have to sign this transaction, fee payer first. Pass exactly these accounts to FTransaction::Build.
+	TArray<FPublicKey> Signers;
+	TArray<FInstruction> Instructions;
+	// Serialized size of the signed legacy transaction, signatures included.
+	int32 Size = 0;
+};
+
+/**
+ * Splits a list of instructions into legacy transactions, trying to keep their number low.
+ *
+ * Every transaction keeps track of its distinct keys, signers and instruction bytes, so the size an instruction
+ * adds is known exactly without compiling a message: an account shared with instructions already in the
+ * transaction costs nothing, a new one costs its 32 bytes plus a signature if it signs. A transaction is full when
+ * it would exceed MaxTransactionSize bytes or MaxTransactionAccounts keys.
+ *
+ * Instructions are packed first fit, largest group first. This is a heuristic, it usually comes close to the fewest
+ * transactions but does not guarantee it. Instructions of one group keep their order: each one goes
+ * into the same transaction as its predecessor or a later one, so sending the transactions in the order Pack returns
+ * them, each after the previous one confirmed, runs every group in order. Separate groups do not depend on each other
+ * and may be reordered.
+ */
+class FInstructionPacker
+{
+public:
+	// Largest serialized transaction the cluster accepts, the size of a network packet minus headers.
+	static constexpr int32 MaxTransactionSize = 1232;
+	// Most accounts a transaction may lock.
+	static constexpr int32 MaxTransactionAccounts = 64;
+
+	/**
+	 * @param InSigners Keys available to sign, the first one pays the fees and signs every transaction. The others
+	 * only sign the transactions whose instructions require them.
+	 */
+	explicit FInstructionPacker(const TArray<FPublicKey>& InSigners);
+
+	// Adds an instruction that does not depend on any other.
+	void Add(const FInstruction& Instruction);
+
+	// Adds instructions that must run in the given order.
+	void AddGroup(const TArray<FInstruction>& Group);
+
+	/**
+	 * Packs every instruction added so far.
+	 * @return false if an instruction does not fit in a transaction on its own or requires a signer that was not given.
+	 */
+	bool Pack(TArray<FPackedTransaction>& OutTransactions) const;
+
+	void Reset();
+
+private:
+	TArray<FPublicKey> Signers;
+
+	TArray<FInstruction> Instructions;
+	// Index of the first instruction of every group, groups are contiguous in Instructions.
+	TArray<int32> GroupStarts;
+};
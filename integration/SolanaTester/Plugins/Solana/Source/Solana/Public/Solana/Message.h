@@ -0,0 +1,118 @@
+#pragma once
+#include "PublicKey.h"
+
+struct FInstruction;
+struct FAddressLookupTableAccount;
+class FByteWriter;
+
+/**
+ * The three counts at the start of every message. Account keys are ordered as
+ * [writable signers][readonly signers][writable non-signers][readonly non-signers],
+ * and the header is what lets the runtime recover those ranges.
+ */
+struct FMessageHeader
+{
+	// Number of signatures the transaction must carry, the first N account keys.
+	uint8 NumRequiredSignatures = 0;
+	// The last N signed keys are read-only.
+	uint8 NumReadonlySignedAccounts = 0;
+	// The last N unsigned keys are read-only.
+	uint8 NumReadonlyUnsignedAccounts = 0;
+};
+
+/**
+ * An instruction with its program and accounts replaced by indices into the message account keys.
+ */
+struct FCompiledInstruction
+{
+	uint8         ProgramIdIndex = 0;
+	TArray<uint8> AccountIndices;
+	TArray<uint8> Data;
+};
+
+/**
+ * A legacy (unversioned) transaction message.
+ *
+ * Compile() deduplicates every key referenced by the instructions through a hash map, merging the signer and
+ * writable flags as it goes, then orders the keys into the four header classes with a stable partition so keys
+ * keep the order in which they were first seen. Serialize() writes the wire format into a single buffer sized
+ * up front by GetSerializedSize().
+ */
+struct FMessage
+{
+	FMessageHeader               Header;
+	TArray<FPublicKey>           AccountKeys;
+	FPublicKey                   RecentBlockhash;
+	TArray<FCompiledInstruction> Instructions;
+
+	/**
+	 * Builds a message from a list of instructions.
+	 * @param Signers Keys that will sign the transaction, the first one pays the fees.
+	 * @return false if there is no fee payer or the message references more than 256 accounts.
+	 */
+	static bool Compile(const TArray<FPublicKey>& Signers, const TArray<FInstruction>& InInstructions, const FPublicKey& InRecentBlockhash,
+		FMessage& OutMessage);
+
+	int32 GetSerializedSize() const;
+
+	// Appends the wire format to Buffer.
+	void Serialize(TArray<uint8>& Buffer) const;
+	TArray<uint8> Serialize() const;
+
+	// Writes the wire format into a caller owned buffer of at least GetSerializedSize() bytes.
+	void Serialize(FByteWriter& Writer) const;
+
+	// Index of a signing key in the signature list, or INDEX_NONE if the key does not sign this message.
+	int32 GetSignerIndex(const FPublicKey& Key) const;
+
+	bool IsWritable(int32 Index) const;
+	bool IsSigner(int32 Index) const { return Index < Header.NumRequiredSignatures; }
+};
+
+/**
+ * Accounts loaded from one address lookup table, as indices into the table.
+ */
+struct FMessageAddressTableLookup
+{
+	FPublicKey    AccountKey;
+	TArray<uint8> WritableIndexes;
+	TArray<uint8> ReadonlyIndexes;
+};
+
+/**
+ * A version 0 transaction message.
+ *
+ * Same layout as FMessage behind a version prefix, except that non-signer accounts found in one of the given
+ * address lookup tables are referenced by a one byte table index instead of their 32 byte key. Instruction
+ * account indices address the static keys first, then the writable lookups of every table, then the read-only
+ * lookups of every table.
+ */
+struct FMessageV0
+{
+	FMessageHeader                     Header;
+	TArray<FPublicKey>                 StaticAccountKeys;
+	FPublicKey                         RecentBlockhash;
+	TArray<FCompiledInstruction>       Instructions;
+	TArray<FMessageAddressTableLookup> AddressTableLookups;
+
+	/**
+	 * Builds a message from a list of instructions, moving every non-signer account that is not a program id
+	 * into the first lookup table containing it.
+	 * @param Signers Keys that will sign the transaction, the first one pays the fees.
+	 * @return false if there is no fee payer or the message addresses more than 256 accounts.
+	 */
+	static bool Compile(const TArray<FPublicKey>& Signers, const TArray<FInstruction>& InInstructions, const FPublicKey& InRecentBlockhash,
+		const TArray<FAddressLookupTableAccount>& LookupTables, FMessageV0& OutMessage);
+
+	int32 GetSerializedSize() const;
+
+	// Appends the wire format, version prefix included, to Buffer.
+	void Serialize(TArray<uint8>& Buffer) const;
+	TArray<uint8> Serialize() const;
+
+	// Writes the wire format into a caller owned buffer of at least GetSerializedSize() bytes.
+	void Serialize(FByteWriter& Writer) const;
+
+	// Index of a signing key in the signature list, or INDEX_NONE if the key does not sign this message.
+	int32 GetSignerIndex(const FPublicKey& Key) const;
+};
@@ -1,9 +1,3 @@
 #pragma once
 
-class FPublicKey : FString
-{
-public:
-	using FString::FString;
-	FPublicKey(FString String);
-	TArray<uint8_t> DecodeBase58() const;
-};
\ No newline at end of file
+#include "SolanaUtils/PublicKey.h"
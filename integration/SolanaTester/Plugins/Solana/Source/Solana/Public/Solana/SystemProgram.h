@@ -0,0 +1,17 @@
+#pragma once
+#include "Instruction.h"
+
+/**
+ * Instructions of the system program.
+ */
+class FSystemProgram
+{
+public:
+	static const FPublicKey ProgramId;
+
+	/**
+	 * Advances a durable nonce. A transaction that uses the nonce as its blockhash must start with this instruction,
+	 * signed by the nonce authority.
+	 */
+	static FInstruction AdvanceNonceAccount(const FPublicKey& NonceAccount, const FPublicKey& Authority);
+};
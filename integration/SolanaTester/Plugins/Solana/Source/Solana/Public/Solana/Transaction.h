@@ -4,11 +4,65 @@
  * License: https://www.apache.org/licenses/LICENSE-2.0
 **/
 #pragma once
+#include "Message.h"
 
-class FPublicKey;
 struct FAccount;
-struct FAccountMeta;
 struct FInstruction;
+struct FAddressLookupTableAccount;
+class FTransactionTemplate;
+
+/**
+ * A serialized transaction whose signatures are filled in place: the signature count, one 64 byte slot per
+ * required signer in message order, then the message. Signatures can be attached as they become available, from
+ * local accounts or from an external signer, without compiling the message again.
+ */
+class FPartiallySignedTransaction
+{
+public:
+	static constexpr int32 SignatureSize = 64;
+
+	int32             GetSlotCount() const { return SlotKeys.Num(); }
+	const FPublicKey& GetSlotKey(int32 Slot) const { return SlotKeys[Slot]; }
+
+	// Slot of the signature of Key, or INDEX_NONE if Key does not sign this transaction.
+	int32 GetSlot(const FPublicKey& Key) const;
+
+	// The bytes every signer signs.
+	const uint8* GetMessage() const { return Bytes.GetData() + MessageOffset; }
+	int32        GetMessageSize() const { return Bytes.Num() - MessageOffset; }
+
+	// Copies a 64 byte signature into a slot. Returns false if Key does not sign this transaction.
+	bool SetSignature(const FPublicKey& Key, const uint8* Signature);
+	void SetSignature(int32 Slot, const uint8* Signature);
+
+	// Signs with every account at once on the task graph, each straight into its slot. Accounts that do not sign this transaction are skipped.
+	void Sign(const TArray<FAccount>& Signers);
+
+	// A slot is empty until a signature is written to it.
+	bool IsSlotFilled(int32 Slot) const;
+	bool IsFullySigned() const;
+
+	// Checks every filled slot against its key with the runtime's rules, see FSignatureBatch::VerifyStrict.
+	bool VerifySignatures() const;
+
+	// The wire format, empty slots are sent as zeroes.
+	const TArray<uint8>& GetBytes() const { return Bytes; }
+
+	// Zeroes every slot, for when the message changed under them.
+	void ClearSignatures();
+
+private:
+	friend class FTransaction;
+	friend class FTransactionTemplate;
+
+	uint8*       GetSlotData(int32 Slot) { return Bytes.GetData() + SignaturesOffset + Slot * SignatureSize; }
+	const uint8* GetSlotData(int32 Slot) const { return Bytes.GetData() + SignaturesOffset + Slot * SignatureSize; }
+
+	TArray<uint8>      Bytes;
+	TArray<FPublicKey> SlotKeys;
+	int32              SignaturesOffset = 0;
+	int32              MessageOffset = 0;
+};
 
 class FTransaction
 {
@@ -18,26 +72,40 @@ public:
 	void AddInstruction(const FInstruction& Instruction);
 	void AddInstructions(const TArray<FInstruction>& InInstructions);
 
+	// Compiles, serializes and signs the transaction, the first signer pays the fees. Returns an empty array on failure.
 	TArray<uint8> Build(const FAccount& Signer);
 	TArray<uint8> Build(const TArray<FAccount>& Signers);
 
+	// Same as above, but writes into OutTransaction and reuses its allocation.
+	bool Build(const TArray<FAccount>& Signers, TArray<uint8>& OutTransaction);
+
+	// Builds a version 0 transaction, non-signer accounts found in the lookup tables are referenced through them.
+	TArray<uint8> Build(const TArray<FAccount>& Signers, const TArray<FAddressLookupTableAccount>& LookupTables);
+
+	// Compiles and serializes the transaction with empty signature slots, to be signed later, fee payer first.
+	bool BuildUnsigned(const TArray<FPublicKey>& Signers, FPartiallySignedTransaction& OutTransaction) const;
+	bool BuildUnsigned(const TArray<FPublicKey>& Signers, const TArray<FAddressLookupTableAccount>& LookupTables,
+		FPartiallySignedTransaction& OutTransaction) const;
+
+	// Compiles the transaction once, to be patched and signed again for every send, fee payer first.
+	bool CompileTemplate(const TArray<FPublicKey>& Signers, FTransactionTemplate& OutTemplate) const;
+	bool CompileTemplate(const TArray<FPublicKey>& Signers, const TArray<FAddressLookupTableAccount>& LookupTables,
+		FTransactionTemplate& OutTemplate) const;
+
+	// Compiles the message without signing it, fee payer first.
+	bool CompileMessage(const TArray<FPublicKey>& Signers, FMessage& OutMessage) const;
+
+	// Signature count followed by the signature of every signer, in order, computed in parallel.
 	static TArray<uint8> Sign(const TArray<uint8>& Message, const TArray<FAccount>& Signers);
 
 private:
-	TArray<uint8> BuildMessage();
-	TArray<uint8> CompileInstructions();
-
-	void UpdateAccountList(const TArray<FAccount>& Signers);
-	void UpdateHeaderInfo(const FAccountMeta& AccountMeta);
+	// Writes the signature count, zeroed signature slots and the message, records the slot of every signer.
+	template <typename MessageType>
+	static void SerializeUnsigned(const MessageType& Message, const TArray<FPublicKey>& MessageKeys, FPartiallySignedTransaction& OutTransaction);
 
-	uint8 GetAccountIndex(const FPublicKey& Key) const;
+	static TArray<FPublicKey> GetSignerKeys(const TArray<FAccount>& Signers);
 
 	TArray<FInstruction> Instructions;
-	TArray<FAccountMeta> AccountList;
-
-	FString BlockHash;
 
-	uint8 RequiredSignatures;
-	uint8 ReadOnlySignedAccounts;
-	uint8 ReadOnlyUnsignedAccounts;
+	FPublicKey BlockHash;
 };
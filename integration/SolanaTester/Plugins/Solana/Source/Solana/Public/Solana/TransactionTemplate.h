@@ -0,0 +1,51 @@
+#pragma once
+#include "Transaction.h"
+
+/**
+ * A transaction compiled once and then patched in place for repeated sends with the same accounts.
+ *
+ * Compiling records where the recent blockhash and the data of every instruction sit in the serialized bytes. Later
+ * sends overwrite those bytes and sign again, skipping key collection, ordering and serialization, so an action that
+ * only changes its arguments costs about one signature per signer. Patches cannot change the size of an instruction's
+ * data, an instruction with a different layout needs a new template.
+ *
+ * Any patch clears the signatures, they no longer match the message.
+ */
+class FTransactionTemplate
+{
+public:
+	int32 GetInstructionCount() const { return InstructionDataOffsets.Num(); }
+	int32 GetInstructionDataSize(int32 Instruction) const { return InstructionDataSizes[Instruction]; }
+
+	void SetBlockhash(const FPublicKey& Blockhash);
+	bool SetBlockhash(const FString& Blockhash);
+
+	// Replaces the whole data of an instruction, Size must be GetInstructionDataSize(Instruction).
+	bool SetInstructionData(int32 Instruction, const uint8* Data, int32 Size);
+	bool SetInstructionData(int32 Instruction, const TArray<uint8>& Data);
+
+	// Overwrites Size bytes at Offset in the data of an instruction, to change a single argument.
+	bool PatchInstructionData(int32 Instruction, int32 Offset, const uint8* Data, int32 Size);
+
+	// Signs the current message in place and returns the wire format, ready to send.
+	const TArray<uint8>& Sign(const TArray<FAccount>& Signers);
+
+	// The underlying transaction, to attach signatures from an external signer.
+	FPartiallySignedTransaction&       GetTransaction() { return Transaction; }
+	const FPartiallySignedTransaction& GetTransaction() const { return Transaction; }
+
+private:
+	friend class FTransaction;
+
+	// Fills the offsets once Transaction holds the unsigned bytes of a message compiled from these keys and instructions.
+	void RecordOffsets(int32 VersionPrefixSize, int32 KeyCount, const TArray<FCompiledInstruction>& Instructions);
+
+	uint8* GetMutableBytes(int32 Offset);
+
+	FPartiallySignedTransaction Transaction;
+
+	// Offsets into the transaction bytes.
+	int32         BlockhashOffset = 0;
+	TArray<int32> InstructionDataOffsets;
+	TArray<int32> InstructionDataSizes;
+};
@@ -0,0 +1,104 @@
+#pragma once
+#include "Message.h"
+
+/**
+ * A compiled instruction, borrowed from the transaction bytes.
+ */
+struct FInstructionView
+{
+	uint8                  ProgramIdIndex = 0;
+	TConstArrayView<uint8> AccountIndices;
+	TConstArrayView<uint8> Data;
+};
+
+/**
+ * An address table lookup of a version 0 message, borrowed from the transaction bytes.
+ */
+struct FAddressTableLookupView
+{
+	const uint8*           AccountKey = nullptr;
+	TConstArrayView<uint8> WritableIndexes;
+	TConstArrayView<uint8> ReadonlyIndexes;
+
+	FPublicKey GetAccountKey() const { return FPublicKey(AccountKey, FPublicKey::Size); }
+};
+
+/**
+ * FTransactionView
+ *
+ * Reads a signed legacy or version 0 transaction in its wire format without copying it. Parse() walks the bytes once,
+ * checks them the way the runtime sanitizes a transaction and records where every section starts: signatures, keys,
+ * the blockhash and instruction data are returned as pointers and views into the original buffer, which must outlive
+ * the view. Only the instruction and lookup tables are allocated, and a view parsed again reuses them.
+ *
+ * Transactions parsed here usually come from outside, so rejections are logged at Verbose level only.
+ */
+class FTransactionView
+{
+public:
+	static constexpr int32 SignatureSize = 64;
+
+	/**
+	 * Parses a serialized transaction into OutView.
+	 * @return false if the bytes are not a well formed transaction: truncated or trailing data, an unknown version,
+	 * signature count not matching the header, inconsistent header, out of range account indices, a program loaded
+	 * through a lookup table or from the fee payer, more than 256 accounts, or an account listed twice. Addresses
+	 * loaded from lookup tables are not known here, only an index repeated within one lookup counts as listed twice.
+	 */
+	static bool Parse(TConstArrayView<uint8> Bytes, FTransactionView& OutView);
+
+	bool IsLegacy() const { return !bVersioned; }
+	// 0 for version 0 messages, meaningless for legacy ones.
+	uint8 GetVersion() const { return Version; }
+
+	int32        GetSignatureCount() const { return Header.NumRequiredSignatures; }
+	const uint8* GetSignature(int32 Index) const { return Data + SignaturesOffset + Index * SignatureSize; }
+
+	// The bytes every signature covers, version prefix included.
+	TConstArrayView<uint8> GetMessage() const { return TConstArrayView<uint8>(Data + MessageOffset, Size - MessageOffset); }
+
+	const FMessageHeader& GetHeader() const { return Header; }
+
+	// Keys written in the message, signers first. Account indices past them address the lookups.
+	int32        GetStaticAccountKeyCount() const { return StaticKeyCount; }
+	const uint8* GetStaticAccountKeyData(int32 Index) const { return Data + KeysOffset + Index * FPublicKey::Size; }
+	FPublicKey   GetStaticAccountKey(int32 Index) const { return FPublicKey(GetStaticAccountKeyData(Index), FPublicKey::Size); }
+
+	// The fee payer signs first.
+	FPublicKey GetFeePayer() const { return GetStaticAccountKey(0); }
+
+	FPublicKey GetRecentBlockhash() const { return FPublicKey(Data + BlockhashOffset, FPublicKey::Size); }
+
+	TConstArrayView<FInstructionView>        GetInstructions() const { return Instructions; }
+	TConstArrayView<FAddressTableLookupView> GetAddressTableLookups() const { return AddressTableLookups; }
+
+	// Static keys plus every address loaded from lookup tables, the range of instruction account indices.
+	int32 GetAccountCount() const { return StaticKeyCount + LoadedWritableCount + LoadedReadonlyCount; }
+
+	// Flags of an account index, lookups included.
+	bool IsSigner(int32 Index) const { return Index < Header.NumRequiredSignatures; }
+	bool IsWritable(int32 Index) const;
+
+	// Checks every signature against its signing key with the runtime's rules, see FSignatureBatch::VerifyStrict.
+	bool VerifySignatures() const;
+
+private:
+	const uint8* Data = nullptr;
+	int32        Size = 0;
+
+	bool           bVersioned = false;
+	uint8          Version = 0;
+	FMessageHeader Header;
+	int32          StaticKeyCount = 0;
+	int32          LoadedWritableCount = 0;
+	int32          LoadedReadonlyCount = 0;
+
+	// Offsets into Data.
+	int32 SignaturesOffset = 0;
+	int32 MessageOffset = 0;
+	int32 KeysOffset = 0;
+	int32 BlockhashOffset = 0;
+
+	TArray<FInstructionView>        Instructions;
+	TArray<FAddressTableLookupView> AddressTableLookups;
+};
@@ -10,5 +10,6 @@
 
 #include "Solana/PublicKey.h"
 
-// `TINY_ADVENTURE` program ID.
-const FPublicKey GTinyAdventureID = FPublicKey(TEXT("2F2K73Sj1ygx4N9ptCegrxEDvGNLCndrsCdmUbcHej3c"));
+// `TINY_ADVENTURE` program ID: 2F2K73Sj1ygx4N9ptCegrxEDvGNLCndrsCdmUbcHej3c
+constexpr FPublicKey GTinyAdventureID = FPublicKey({ 18, 115, 77, 73, 12, 169, 85, 60, 104, 110, 118, 206, 117, 99, 243, 184, 52, 41, 238, 122, 204,
+	218, 68, 135, 242, 8, 124, 184, 60, 51, 134, 39 });
@@ -0,0 +1,102 @@
+// Generates precomp_data51.h, the base point tables of the radix 2^51 field backend of the vendored Ed25519 code.
+//
+//   deno run scripts/ed25519-tables.ts > integration/SolanaTester/Plugins/FoundationKit/Source/Foundation/Private/Crypto/ed25519/precomp_data51.h
+
+const p = 2n ** 255n - 19n;
+
+function mod(a: bigint): bigint {
+  const r = a % p;
+  return r < 0n ? r + p : r;
+}
+
+function pow(base: bigint, exponent: bigint): bigint {
+  let result = 1n;
+  base = mod(base);
+  while (exponent > 0n) {
+    if (exponent & 1n) result = mod(result * base);
+    base = mod(base * base);
+    exponent >>= 1n;
+  }
+  return result;
+}
+
+function inv(a: bigint): bigint {
+  return pow(a, p - 2n);
+}
+
+const d = mod(-121665n * inv(121666n));
+const sqrtm1 = pow(2n, (p - 1n) / 4n);
+
+type Point = { x: bigint; y: bigint };
+
+function recoverX(y: bigint): bigint {
+  const xx = mod((y * y - 1n) * inv(d * y * y + 1n));
+  let x = pow(xx, (p + 3n) / 8n);
+  if (mod(x * x - xx) !== 0n) x = mod(x * sqrtm1);
+  return x & 1n ? p - x : x;
+}
+
+function add(a: Point, b: Point): Point {
+  const t = mod(d * a.x * b.x * a.y * b.y);
+  return {
+    x: mod((a.x * b.y + b.x * a.y) * inv(1n + t)),
+    y: mod((a.y * b.y + a.x * b.x) * inv(1n - t)),
+  };
+}
+
+function limbs(value: bigint): string {
+  const out: string[] = [];
+  for (let i = 0; i < 5; i++) {
+    out.push("0x" + ((value >> BigInt(51 * i)) & ((1n << 51n) - 1n)).toString(16) + "ULL");
+  }
+  return "{ " + out.join(", ") + " }";
+}
+
+function precomp(point: Point, indent: string): string[] {
+  return [
+    indent + "{",
+    indent + "    " + limbs(mod(point.y + point.x)) + ",",
+    indent + "    " + limbs(mod(point.y - point.x)) + ",",
+    indent + "    " + limbs(mod(2n * d * point.x * point.y)) + ",",
+    indent + "},",
+  ];
+}
+
+const y = mod(4n * inv(5n));
+const B: Point = { x: recoverX(y), y };
+
+const lines: string[] = [];
+lines.push("/* Generated by scripts/ed25519-tables.ts, do not edit. */");
+lines.push("");
+lines.push("/* Bi[i] = (2i+1)*B */");
+lines.push("static const ge_precomp Bi[8] = {");
+{
+  const twoB = add(B, B);
+  let point = B;
+  for (let i = 0; i < 8; i++) {
+    lines.push(...precomp(point, "    "));
+    point = add(point, twoB);
+  }
+}
+lines.push("};");
+lines.push("");
+lines.push("");
+lines.push("/* base[i][j] = (j+1)*16^i*B */");
+lines.push("static const ge_precomp base[64][8] = {");
+{
+  let row = B;
+  for (let i = 0; i < 64; i++) {
+    lines.push("    {");
+    let point = row;
+    for (let j = 0; j < 8; j++) {
+      lines.push(...precomp(point, "        "));
+      point = add(point, row);
+    }
+    lines.push("    },");
+    for (let k = 0; k < 4; k++) row = add(row, row);
+  }
+}
+lines.push("};");
+lines.push("");
+
+Deno.stdout.writeSync(new TextEncoder().encode(lines.join("\r\n")));
@@ -2,7 +2,7 @@ import { arrayValueNode, bytesValueNode, isNode, numberValueNode, pascalCase, Re
 import { visit, Visitor } from "@kinobi-so/visitors-core";
 
 import { IncludeMap } from "./IncludeMap.ts";
-import { getBytesFromBytesValueNode } from "./utils/codecs.ts";
+import { getBytesFromBytesValueNode, renderPublicKeyBytes } from "./utils/codecs.ts";
 
 export function renderValueNode(
     value: ValueNode,
@@ -119,7 +119,7 @@ export function renderValueNodeVisitor(useStr: boolean = false): Visitor<
         visitPublicKeyValue(node) {
             return {
                 imports: new IncludeMap().add("Solana/PublicKey.h"),
-                render: `FPublicKey("${node.publicKey}")`,
+                render: `FPublicKey({ ${renderPublicKeyBytes(node.publicKey)} })`,
             };
         },
         visitSetValue(node) {
@@ -19,3 +19,11 @@ export function getBytesFromBytesValueNode(node: BytesValueNode): Uint8Array {
             return getBase64Encoder().encode(node.data);
     }
 }
+
+export function getBytesFromPublicKey(publicKey: string): Uint8Array {
+    return getBase58Encoder().encode(publicKey);
+}
+
+export function renderPublicKeyBytes(publicKey: string): string {
+    return Array.from(getBytesFromPublicKey(publicKey)).join(", ");
+}
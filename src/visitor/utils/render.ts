@@ -10,6 +10,8 @@ import {
 } from "@kinobi-so/nodes";
 import nunjucks, { ConfigureOptions as NunJucksOptions } from "nunjucks";
 
+import { renderPublicKeyBytes } from "./codecs.ts";
+
 export function cppDocblock(docs: string[]): string {
     if (docs.length <= 0) return "";
     const lines = docs.map((doc) => `// ${doc}`);
@@ -39,5 +41,6 @@ export const render = (
     env.addFilter("titleCase", titleCase);
     env.addFilter("constantCase", constantCase);
     env.addFilter("rustDocblock", cppDocblock);
+    env.addFilter("publicKeyBytes", renderPublicKeyBytes);
     return env.render(template, context);
 };